@@ -0,0 +1,9 @@
+#include <EnumeratorTraits.hpp>
+
+enum class Benchmarked : int {
+    kFirst = -7, kSecond = -3, kThird = 0, kFourth = 1, kFifth = 2, kSixth = 5, kSeventh = 11, kEighth = 42,
+};
+
+// BENCH_MAXN comes from CMake
+static_assert(EnumeratorTraits<Benchmarked, BENCH_MAXN>::size() == 8);
+static_assert(EnumeratorTraits<Benchmarked, BENCH_MAXN>::nameAt(0) == "kFirst");
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Compiler launcher and report writer for the compile-time benchmarks.
+
+measure: runs the compile command given after `--`, then writes <family>_<parameter>.json to the
+    report directory with the wall time and peak memory of the compiler and the path of its
+    -ftime-trace (Clang) or -ftime-report (GCC) output.
+collect: merges the files of the named benchmarks into report.csv and report.json.
+"""
+
+import argparse
+import json
+import os
+import resource
+import subprocess
+import sys
+import time
+
+FIELDS = ["family", "parameter", "compiler", "wall_seconds", "peak_memory_kib", "trace"]
+
+
+def output_path(command):
+    for i, argument in enumerate(command[:-1]):
+        if argument == "-o":
+            return command[i + 1]
+    return None
+
+
+def measure(args):
+    command = args.command[1:] if args.command[:1] == ["--"] else args.command
+    os.makedirs(args.report_dir, exist_ok=True)
+    name = f"{args.family}_{args.parameter}"
+
+    start = time.perf_counter()
+    result = subprocess.run(command, stderr=subprocess.PIPE, text=True)
+    wall_seconds = time.perf_counter() - start
+    # Only the compiler has run as a child of this process, so this is its peak RSS
+    peak_memory_kib = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+
+    if result.returncode != 0:
+        sys.stderr.write(result.stderr)
+        return result.returncode
+
+    trace = None
+    obj = output_path(command)
+
+    if "-ftime-trace" in command and obj is not None:
+        candidate = os.path.splitext(obj)[0] + ".json"
+        trace = candidate if os.path.exists(candidate) else None
+    elif "-ftime-report" in command:
+        trace = os.path.join(args.report_dir, name + ".time-report.txt")
+        with open(trace, "w") as file:
+            file.write(result.stderr)
+
+    record = {
+        "family": args.family,
+        "parameter": int(args.parameter),
+        "compiler": os.path.basename(command[0]),
+        "wall_seconds": round(wall_seconds, 4),
+        "peak_memory_kib": peak_memory_kib,
+        "trace": trace,
+    }
+
+    with open(os.path.join(args.report_dir, name + ".json"), "w") as file:
+        json.dump(record, file, indent=2)
+
+    return 0
+
+
+def collect(args):
+    records = []
+
+    # Only the benchmarks that are still configured, so results of removed ones do not linger
+    for name in args.benchmarks:
+        with open(os.path.join(args.report_dir, name + ".json")) as file:
+            records.append(json.load(file))
+
+    records.sort(key=lambda record: (record["family"], record["parameter"]))
+
+    with open(os.path.join(args.report_dir, "report.json"), "w") as file:
+        json.dump(records, file, indent=2)
+
+    with open(os.path.join(args.report_dir, "report.csv"), "w") as file:
+        file.write(",".join(FIELDS) + "\n")
+        for record in records:
+            file.write(",".join("" if record[field] is None else str(record[field]) for field in FIELDS) + "\n")
+
+    for record in records:
+        print(f"{record['family']:>22} {record['parameter']:>6} {record['wall_seconds']:>9.3f} s "
+              f"{record['peak_memory_kib'] / 1024:>9.1f} MiB")
+
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="mode", required=True)
+
+    measure_parser = commands.add_parser("measure")
+    measure_parser.add_argument("--report-dir", required=True)
+    measure_parser.add_argument("--family", required=True)
+    measure_parser.add_argument("--parameter", required=True)
+    measure_parser.add_argument("command", nargs=argparse.REMAINDER)
+
+    collect_parser = commands.add_parser("collect")
+    collect_parser.add_argument("--report-dir", required=True)
+    collect_parser.add_argument("benchmarks", nargs="*")
+
+    args = parser.parse_args()
+    return measure(args) if args.mode == "measure" else collect(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
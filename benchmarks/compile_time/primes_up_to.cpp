@@ -0,0 +1,4 @@
+#include <fun_value_sequences.hpp>
+
+// BENCH_N comes from CMake
+static_assert(PrimesUpTo<BENCH_N>.back() <= BENCH_N);
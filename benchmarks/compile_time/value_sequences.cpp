@@ -0,0 +1,6 @@
+#include <fun_value_sequences.hpp>
+
+// BENCH_SEQUENCE and BENCH_N come from CMake
+using Instantiated = type_lists::ToTuple<type_lists::Take<BENCH_N, BENCH_SEQUENCE>>;
+
+static_assert(sizeof(Instantiated) > 0);
@@ -0,0 +1,96 @@
+// Formats the same log line with CompiledFormat, snprintf and, where the standard library has
+// it, std::format_to, and prints the time per line. All three write into a stack buffer.
+
+#include <CompiledFormat.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+namespace {
+
+struct Request {
+  std::string_view method;
+  std::uint64_t id;
+  std::int32_t status;
+  double milliseconds;
+};
+
+std::vector<Request> MakeRequests(std::size_t count) {
+  constexpr std::string_view methods[] = {"GET", "POST", "PUT", "DELETE"};
+  std::vector<Request> requests;
+
+  for (std::size_t i = 0; i < count; ++i) {
+    requests.push_back({methods[i % 4], 1000003 * i, static_cast<std::int32_t>(200 + i % 300),
+                        static_cast<double>(i % 977) / 8});
+  }
+
+  return requests;
+}
+
+template<typename Formatter>
+double NanosecondsPerLine(const std::vector<Request> &requests, int repetitions, Formatter formatter) {
+  using Clock = std::chrono::steady_clock;
+
+  char buffer[256];
+  std::size_t written = 0;
+  auto start = Clock::now();
+
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    for (const auto &request : requests) {
+      written += formatter(buffer, request);
+    }
+  }
+
+  auto end = Clock::now();
+
+  if (written == 0) {
+    std::puts(buffer);
+  }
+
+  auto lines = static_cast<double>(requests.size()) * repetitions;
+  return std::chrono::duration<double, std::nano>(end - start).count() / lines;
+}
+
+} // namespace
+
+int main() {
+  constexpr std::size_t count = 1 << 16;
+  constexpr int repetitions = 32;
+
+  auto requests = MakeRequests(count);
+
+  auto compiled = [](char *buffer, const Request &request) {
+    auto end = FormatTo<"{} request {} finished with {} in {} ms">(
+        buffer, request.method, request.id, request.status, request.milliseconds);
+    return static_cast<std::size_t>(end - buffer);
+  };
+
+  auto printf_style = [](char *buffer, const Request &request) {
+    return static_cast<std::size_t>(std::snprintf(
+        buffer, 256, "%.*s request %llu finished with %d in %g ms", static_cast<int>(request.method.size()),
+        request.method.data(), static_cast<unsigned long long>(request.id), request.status, request.milliseconds));
+  };
+
+  std::printf("%-16s %12s\n", "formatter", "ns per line");
+  std::printf("%-16s %12.2f\n", "CompiledFormat", NanosecondsPerLine(requests, repetitions, compiled));
+  std::printf("%-16s %12.2f\n", "snprintf", NanosecondsPerLine(requests, repetitions, printf_style));
+
+#if defined(__cpp_lib_format)
+  auto standard = [](char *buffer, const Request &request) {
+    auto end = std::format_to(buffer, "{} request {} finished with {} in {} ms",
+                              request.method, request.id, request.status, request.milliseconds);
+    return static_cast<std::size_t>(end - buffer);
+  };
+
+  std::printf("%-16s %12.2f\n", "std::format_to", NanosecondsPerLine(requests, repetitions, standard));
+#else
+  std::printf("%-16s %12s\n", "std::format_to", "unavailable");
+#endif
+}
@@ -0,0 +1,63 @@
+// Compares std::tuple with type_tuples::PackedTuple for a few record schemas: the size of one
+// record, and the time to scan one field over a large array of records (fewer bytes per record
+// means more records per cache line).
+
+#include <packed_tuple.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+template<template<typename...> typename Tuple, typename... Ts>
+double ScanNanoseconds(std::size_t count, int repetitions) {
+  std::vector<Tuple<Ts...>> records(count);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    get<1>(records[i]) = static_cast<std::tuple_element_t<1, Tuple<Ts...>>>(i);
+  }
+
+  using Clock = std::chrono::steady_clock;
+
+  double sum = 0;
+  auto start = Clock::now();
+
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    for (const auto &record : records) {
+      sum += static_cast<double>(get<1>(record));
+    }
+  }
+
+  auto end = Clock::now();
+
+  if (sum < 0) {
+    std::puts("");
+  }
+
+  return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(count * repetitions);
+}
+
+template<typename... Ts>
+void Report(const char *schema, std::size_t count, int repetitions) {
+  std::printf("%-40s %8zu %8zu %12.3f %12.3f\n", schema,
+              sizeof(std::tuple<Ts...>), sizeof(type_tuples::PackedTuple<Ts...>),
+              ScanNanoseconds<std::tuple, Ts...>(count, repetitions),
+              ScanNanoseconds<type_tuples::PackedTuple, Ts...>(count, repetitions));
+}
+
+} // namespace
+
+int main() {
+  constexpr std::size_t count = 1 << 22;
+  constexpr int repetitions = 8;
+
+  std::printf("%-40s %8s %8s %12s %12s\n", "schema", "tuple B", "packed B", "tuple ns", "packed ns");
+
+  Report<char, double, char>("char, double, char", count, repetitions);
+  Report<bool, std::int64_t, bool, std::int32_t, bool>("bool, int64, bool, int32, bool", count, repetitions);
+  Report<char, std::int32_t, char, std::int16_t, char, double>("char, int32, char, int16, char, double", count, repetitions);
+  Report<std::int16_t, double, std::int8_t, float>("int16, double, int8, float", count, repetitions);
+}
@@ -0,0 +1,83 @@
+// Sums one column of a row-major float table through a plain Slice and through PrefetchingSlice
+// with a few prefetch distances, for a sweep of row widths (the stride of the column), and prints
+// the time per element. The table is larger than the last-level cache for every width.
+
+#include <PrefetchingSlice.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+using Column = Slice<float, std::dynamic_extent, dynamic_stride>;
+
+template<typename View>
+double NanosecondsPerElement(const View &column, int repetitions) {
+  using Clock = std::chrono::steady_clock;
+
+  float sum = 0;
+  auto start = Clock::now();
+
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    for (auto value : column) {
+      sum += value;
+    }
+  }
+
+  auto end = Clock::now();
+
+  if (sum < 0) {
+    std::puts("");
+  }
+
+  auto elements = static_cast<double>(column.Size()) * repetitions;
+  return std::chrono::duration<double, std::nano>(end - start).count() / elements;
+}
+
+// Each repetition scans a different column, so no repetition finds the previous one in the cache
+template<std::size_t distance>
+double PrefetchedNanoseconds(std::vector<float> &table, std::size_t rows, std::ptrdiff_t width, int repetitions) {
+  double total = 0;
+
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    Column column(table.data() + repetition % width, rows, width);
+    total += NanosecondsPerElement(Prefetching<distance>(column), 1);
+  }
+
+  return total / repetitions;
+}
+
+double PlainNanoseconds(std::vector<float> &table, std::size_t rows, std::ptrdiff_t width, int repetitions) {
+  double total = 0;
+
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    Column column(table.data() + repetition % width, rows, width);
+    total += NanosecondsPerElement(column, 1);
+  }
+
+  return total / repetitions;
+}
+
+} // namespace
+
+int main() {
+  constexpr std::size_t table_floats = std::size_t{1} << 25;
+  constexpr int repetitions = 8;
+
+  std::vector<float> table(table_floats, 1.0f);
+
+  std::printf("%10s %10s %10s %10s %10s %10s\n", "width", "plain ns", "dist 4", "dist 8", "dist 16", "dist 32");
+
+  for (std::ptrdiff_t width : {16, 64, 256, 1024, 4096}) {
+    auto rows = table_floats / static_cast<std::size_t>(width);
+
+    std::printf("%10td %10.3f %10.3f %10.3f %10.3f %10.3f\n", width,
+                PlainNanoseconds(table, rows, width, repetitions),
+                PrefetchedNanoseconds<4>(table, rows, width, repetitions),
+                PrefetchedNanoseconds<8>(table, rows, width, repetitions),
+                PrefetchedNanoseconds<16>(table, rows, width, repetitions),
+                PrefetchedNanoseconds<32>(table, rows, width, repetitions));
+  }
+}
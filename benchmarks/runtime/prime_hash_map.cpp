@@ -0,0 +1,102 @@
+// Inserts and looks up skewed keys in a prime-sized OpenAddressingMap, the same map with
+// power-of-two capacities and std::unordered_map, and prints the time per operation.
+//
+// The key sets model what power-of-two tables handle badly: identity-hashed integers that share
+// their low bits (aligned addresses, strided ids) and a Zipf-like lookup stream over them.
+
+#include <prime_hash_map.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct KeySet {
+  std::string name;
+  std::vector<std::uint64_t> inserted;
+  std::vector<std::uint64_t> looked_up;
+};
+
+KeySet Strided(std::size_t count, std::uint64_t stride) {
+  KeySet keys{"stride " + std::to_string(stride), {}, {}};
+  std::mt19937_64 random(stride);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    keys.inserted.push_back(i * stride);
+  }
+
+  // Lookups follow a Zipf-like law: key i is requested with probability proportional to 1 / (i + 1)
+  std::uniform_real_distribution<double> uniform(0, std::log(static_cast<double>(count)));
+
+  for (std::size_t i = 0; i < 4 * count; ++i) {
+    auto rank = static_cast<std::size_t>(std::exp(uniform(random))) - 1;
+    keys.looked_up.push_back(rank * stride);
+  }
+
+  return keys;
+}
+
+template<class Map>
+std::pair<double, double> Measure(const KeySet &keys) {
+  using Clock = std::chrono::steady_clock;
+
+  Map map;
+
+  auto start = Clock::now();
+
+  for (auto key : keys.inserted) {
+    map[key] = static_cast<std::uint32_t>(key);
+  }
+
+  auto middle = Clock::now();
+  std::uint64_t found = 0;
+
+  for (auto key : keys.looked_up) {
+    if constexpr (requires { map.Find(key); }) {
+      found += map.Find(key) != nullptr;
+    } else {
+      found += map.find(key) != map.end();
+    }
+  }
+
+  auto end = Clock::now();
+
+  if (found != keys.looked_up.size()) {
+    std::fprintf(stderr, "lost keys\n");
+  }
+
+  auto nanoseconds = [](auto duration) {
+    return std::chrono::duration<double, std::nano>(duration).count();
+  };
+
+  return {nanoseconds(middle - start) / static_cast<double>(keys.inserted.size()),
+          nanoseconds(end - middle) / static_cast<double>(keys.looked_up.size())};
+}
+
+template<class Map>
+void Report(const char *name, const KeySet &keys) {
+  auto [insert, lookup] = Measure<Map>(keys);
+  std::printf("%-14s %-24s %10.1f %10.1f\n", keys.name.c_str(), name, insert, lookup);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::size_t count = argc > 1 ? std::stoul(argv[1]) : 200000;
+
+  std::printf("%-14s %-24s %10s %10s\n", "keys", "table", "insert ns", "lookup ns");
+
+  for (std::uint64_t stride : {1, 64, 4096}) {
+    auto keys = Strided(count, stride);
+
+    Report<PrimeHashMap<std::uint64_t, std::uint32_t>>("prime capacities", keys);
+    Report<OpenAddressingMap<std::uint64_t, std::uint32_t, PowerOfTwoCapacities>>("power-of-two capacities", keys);
+    Report<std::unordered_map<std::uint64_t, std::uint32_t>>("std::unordered_map", keys);
+  }
+}
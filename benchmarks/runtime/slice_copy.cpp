@@ -0,0 +1,99 @@
+// Compares CopySlice/MoveSlice with the element-by-element std::copy through Slice::iterator
+// they replace: contiguous copies, gathering a column into a buffer, scattering it back, and
+// shifting a range within one buffer so that source and destination overlap. The small size
+// stays in the cache and shows the loop overhead; the large one is bound by memory bandwidth.
+
+#include <SliceCopy.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+// Every copy is run once untimed, so both sides start from the same cache state
+template<typename Copy>
+double NanosecondsPerElement(std::size_t count, int repetitions, Copy copy) {
+  using Clock = std::chrono::steady_clock;
+
+  copy();
+
+  auto start = Clock::now();
+
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    copy();
+  }
+
+  auto end = Clock::now();
+  auto elements = static_cast<double>(count) * repetitions;
+  return std::chrono::duration<double, std::nano>(end - start).count() / elements;
+}
+
+template<typename SliceCopy, typename IteratorCopy>
+void Report(const char *name, std::size_t count, int repetitions, SliceCopy slice_copy, IteratorCopy iterator_copy) {
+  std::printf("%-32s %10zu %12.3f %12.3f\n", name, count,
+              NanosecondsPerElement(count, repetitions, iterator_copy),
+              NanosecondsPerElement(count, repetitions, slice_copy));
+}
+
+void Run(std::size_t count, int repetitions) {
+  constexpr std::ptrdiff_t width = 8;
+
+  std::vector<double> table(count * width, 1.0);
+  std::vector<double> buffer(count, 2.0);
+  std::vector<double> other(count, 3.0);
+
+  Slice<double> contiguous(buffer);
+  Slice<double> target(other);
+  Slice<double, std::dynamic_extent, width> column(table.data(), count, width);
+  Slice<double, std::dynamic_extent, dynamic_stride> dynamic_column(table.data() + 1, count, width);
+
+  // Shifting by a few elements inside one buffer: the ranges overlap almost completely
+  Slice<double> head(table.data(), count, 1);
+  Slice<double> shifted(table.data() + 3, count, 1);
+
+  Report("contiguous -> contiguous", count, repetitions,
+         [&] { CopySlice(contiguous, target); },
+         [&] { std::copy(contiguous.begin(), contiguous.end(), target.begin()); });
+
+  Report("static column -> contiguous", count, repetitions,
+         [&] { CopySlice(column, target); },
+         [&] { std::copy(column.begin(), column.end(), target.begin()); });
+
+  Report("dynamic column -> contiguous", count, repetitions,
+         [&] { CopySlice(dynamic_column, target); },
+         [&] { std::copy(dynamic_column.begin(), dynamic_column.end(), target.begin()); });
+
+  Report("contiguous -> static column", count, repetitions,
+         [&] { CopySlice(contiguous, column); },
+         [&] { std::copy(contiguous.begin(), contiguous.end(), column.begin()); });
+
+  Report("overlapping shift forward", count, repetitions,
+         [&] { MoveSlice(head, shifted); },
+         [&] { std::move_backward(head.begin(), head.end(), shifted.end()); });
+
+  Report("overlapping shift backward", count, repetitions,
+         [&] { MoveSlice(shifted, head); },
+         [&] { std::move(shifted.begin(), shifted.end(), head.begin()); });
+
+  double checksum = 0;
+
+  for (auto value : other) {
+    checksum += value;
+  }
+
+  if (checksum < 0) {
+    std::puts("");
+  }
+}
+
+} // namespace
+
+int main() {
+  std::printf("%-32s %10s %12s %12s\n", "case", "elements", "iterator ns", "slice ns");
+
+  Run(std::size_t{1} << 12, 1 << 14);
+  Run(std::size_t{1} << 20, 64);
+}
@@ -0,0 +1,127 @@
+// Runs the same filter-and-transform pipelines as slice_views/std::views compositions over a Slice
+// and as hand-written loops, and prints the time per input element. The pipelines are lazy and
+// allocate nothing, so they should cost about as much as the loops.
+
+#include <SliceViews.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ranges>
+#include <vector>
+
+namespace {
+
+template<typename Run>
+double NanosecondsPerElement(std::size_t count, int repetitions, Run run) {
+  using Clock = std::chrono::steady_clock;
+
+  std::int64_t sum = 0;
+  auto start = Clock::now();
+
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    sum += run();
+  }
+
+  auto end = Clock::now();
+
+  if (sum == 42) {
+    std::puts("");
+  }
+
+  auto elements = static_cast<double>(count) * repetitions;
+  return std::chrono::duration<double, std::nano>(end - start).count() / elements;
+}
+
+template<typename Pipeline, typename Loop>
+void Report(const char *name, std::size_t count, int repetitions, Pipeline pipeline, Loop loop) {
+  std::printf("%-40s %12.3f %12.3f\n", name,
+              NanosecondsPerElement(count, repetitions, loop),
+              NanosecondsPerElement(count, repetitions, pipeline));
+}
+
+} // namespace
+
+int main() {
+  constexpr std::size_t count = 1 << 22;
+  constexpr int repetitions = 32;
+
+  std::vector<std::int32_t> values(count);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    values[i] = static_cast<std::int32_t>(i * 2654435761u % 1000);
+  }
+
+  Slice<std::int32_t> all(values);
+
+  auto square = [](std::int32_t x) {
+    return static_cast<std::int64_t>(x) * x;
+  };
+
+  auto odd = [](std::int32_t x) {
+    return x % 2 != 0;
+  };
+
+  std::printf("%-40s %12s %12s\n", "pipeline", "loop ns", "view ns");
+
+  Report("filter | transform", count, repetitions,
+         [&] {
+           std::int64_t sum = 0;
+
+           for (auto x : all | std::views::filter(odd) | std::views::transform(square)) {
+             sum += x;
+           }
+
+           return sum;
+         },
+         [&] {
+           std::int64_t sum = 0;
+
+           for (std::size_t i = 0; i < count; ++i) {
+             if (odd(values[i])) {
+               sum += square(values[i]);
+             }
+           }
+
+           return sum;
+         });
+
+  Report("skip<2> | drop(16) | take | transform", count / 2, repetitions,
+         [&] {
+           std::int64_t sum = 0;
+           auto pipeline = all | slice_views::skip<2> | slice_views::drop(16) | slice_views::take(count / 2 - 16)
+               | std::views::transform(square);
+
+           for (auto x : pipeline) {
+             sum += x;
+           }
+
+           return sum;
+         },
+         [&] {
+           std::int64_t sum = 0;
+
+           for (std::size_t i = 16; i < count / 2; ++i) {
+             sum += square(values[2 * i]);
+           }
+
+           return sum;
+         });
+
+  Report("stride(4) | filter | ranges::count_if", count / 4, repetitions,
+         [&] {
+           auto strided = all | slice_views::stride(4);
+           return static_cast<std::int64_t>(std::ranges::count_if(strided, odd));
+         },
+         [&] {
+           std::int64_t found = 0;
+
+           for (std::size_t i = 0; i < count; i += 4) {
+             found += odd(values[i]);
+           }
+
+           return found;
+         });
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <Slice.hpp>
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Hands out `alignment`-aligned blocks rounded up to a power of two (never below `alignment`), so every
+// buffer comes with tail padding up to its size class. Freed blocks go to a per-class free list and small
+// classes are carved out of large chunks; anything bigger than a chunk is allocated on its own.
+template<std::size_t alignment>
+requires (std::has_single_bit(alignment))
+class AlignedPool {
+ public:
+  explicit AlignedPool(std::size_t chunk_bytes = std::size_t{1} << 20)
+      : chunk_bytes_(std::bit_ceil(std::max(chunk_bytes, alignment))) {}
+
+  AlignedPool(const AlignedPool &) = delete;
+  AlignedPool &operator=(const AlignedPool &) = delete;
+
+  ~AlignedPool() {
+    for (auto *chunk : chunks_) {
+      ::operator delete(chunk, std::align_val_t{alignment});
+    }
+  }
+
+  [[nodiscard]] static std::size_t Capacity(std::size_t bytes) {
+    return std::bit_ceil(std::max(bytes, alignment));
+  }
+
+  [[nodiscard]] void *Allocate(std::size_t bytes) {
+    auto capacity = Capacity(bytes);
+
+    if (capacity > chunk_bytes_) {
+      return ::operator new(capacity, std::align_val_t{alignment});
+    }
+
+    std::lock_guard lock(mutex_);
+    auto &free_list = free_lists_[std::countr_zero(capacity)];
+
+    if (!free_list.empty()) {
+      auto *block = free_list.back();
+      free_list.pop_back();
+      return block;
+    }
+
+    if (chunk_left_ < capacity) {
+      chunk_cursor_ = static_cast<std::byte *>(::operator new(chunk_bytes_, std::align_val_t{alignment}));
+      chunk_left_ = chunk_bytes_;
+      chunks_.push_back(chunk_cursor_);
+    }
+
+    // Chunks are aligned and every class is a multiple of `alignment`, so the cursor stays aligned
+    auto *block = chunk_cursor_;
+    chunk_cursor_ += capacity;
+    chunk_left_ -= capacity;
+    return block;
+  }
+
+  void Deallocate(void *block, std::size_t bytes) {
+    auto capacity = Capacity(bytes);
+
+    if (capacity > chunk_bytes_) {
+      ::operator delete(block, std::align_val_t{alignment});
+      return;
+    }
+
+    std::lock_guard lock(mutex_);
+    free_lists_[std::countr_zero(capacity)].push_back(block);
+  }
+
+ private:
+  std::size_t chunk_bytes_;
+
+  std::mutex mutex_;
+  std::vector<void *> free_lists_[64];
+  std::vector<std::byte *> chunks_;
+  std::byte *chunk_cursor_ = nullptr;
+  std::size_t chunk_left_ = 0;
+};
+
+template<class T, std::size_t alignment, std::size_t extent, std::ptrdiff_t stride, bool padded>
+class AlignedSlice;
+
+// Owning buffer of `count` value-initialised elements drawn from an AlignedPool
+template<class T, std::size_t alignment>
+requires std::is_trivially_destructible_v<T> && (alignment >= alignof(T))
+class AlignedBuffer {
+ public:
+  AlignedBuffer(AlignedPool<alignment> &pool, std::size_t count)
+      : pool_(&pool), count_(count), data_(static_cast<T *>(pool.Allocate(count * sizeof(T)))) {
+    std::uninitialized_value_construct_n(data_, count_);
+  }
+
+  AlignedBuffer(AlignedBuffer &&other) noexcept
+      : pool_(other.pool_), count_(std::exchange(other.count_, 0)), data_(std::exchange(other.data_, nullptr)) {}
+
+  AlignedBuffer &operator=(AlignedBuffer &&other) noexcept {
+    std::swap(pool_, other.pool_);
+    std::swap(count_, other.count_);
+    std::swap(data_, other.data_);
+    return *this;
+  }
+
+  ~AlignedBuffer() {
+    if (data_) {
+      pool_->Deallocate(data_, count_ * sizeof(T));
+    }
+  }
+
+  [[nodiscard]] std::size_t size() const {
+    return count_;
+  }
+
+  [[nodiscard]] T *data() const {
+    return data_;
+  }
+
+  AlignedSlice<T, alignment, std::dynamic_extent, 1, true> View() const {
+    return {data_, count_, 1};
+  }
+
+ private:
+  AlignedPool<alignment> *pool_;
+  std::size_t count_;
+  T *data_;
+};
+
+namespace {
+
+template<typename T>
+struct IsAlignedBuffer : std::false_type {
+};
+
+template<class T, std::size_t alignment>
+struct IsAlignedBuffer<AlignedBuffer<T, alignment>> : std::true_type {
+};
+
+} // namespace
+
+// Slice whose first element is known at compile time to sit on an `alignment` boundary. With `padded`
+// the memory up to the next `alignment` boundary after the last element is also readable, so kernels can
+// finish with a full aligned vector instead of a scalar tail. Only views that provably keep the start
+// aligned return AlignedSlices again; the rest decay to plain Slices.
+template<class T, std::size_t alignment, std::size_t extent = std::dynamic_extent, std::ptrdiff_t stride = 1,
+    bool padded = false>
+class AlignedSlice : public Slice<T, extent, stride> {
+  using Base = Slice<T, extent, stride>;
+
+  template<class, std::size_t, std::size_t, std::ptrdiff_t, bool>
+  friend class AlignedSlice;
+
+  template<class U, std::size_t buffer_alignment> requires std::is_trivially_destructible_v<U>
+      && (buffer_alignment >= alignof(U))
+  friend class AlignedBuffer;
+
+ public:
+  static_assert(std::has_single_bit(alignment) && alignment >= alignof(T));
+
+  AlignedSlice() = default;
+
+  // Views with at least the same guarantees convert implicitly
+  template<std::size_t other_alignment, bool other_padded>
+  requires (other_alignment % alignment == 0) && (other_padded || !padded)
+  AlignedSlice(const AlignedSlice<T, other_alignment, extent, stride, other_padded> &other)
+      : Base(other) {}
+
+  template<class Buffer> requires IsAlignedBuffer<Buffer>::value
+  AlignedSlice(const Buffer &buffer) : AlignedSlice(buffer.View()) {}
+
+  // Unpadded view over memory the caller vouches for; checked in debug builds
+  static AlignedSlice FromAligned(T *data, std::size_t count, std::ptrdiff_t skip = stride) requires (!padded) {
+    assert(reinterpret_cast<std::uintptr_t>(data) % alignment == 0);
+    return {data, count, skip};
+  }
+
+  [[nodiscard]] T *Data() const {
+    return std::assume_aligned<alignment>(Base::Data());
+  }
+
+  T &operator[](std::size_t index) const {
+    return Data()[static_cast<std::ptrdiff_t>(index) * this->Stride()];
+  }
+
+  AlignedSlice<T, alignment, std::dynamic_extent, stride, padded> First(std::size_t count) const {
+    return {Data(), std::min(count, this->Size()), this->Stride()};
+  }
+
+  template<std::size_t count>
+  AlignedSlice<T, alignment, count, stride, padded> First() const {
+    return {Data(), count, this->Stride()};
+  }
+
+  AlignedSlice<T, alignment, std::dynamic_extent, stride, padded> DropLast(std::size_t count) const {
+    return {Data(), this->Size() - count, this->Stride()};
+  }
+
+  template<std::size_t count>
+  AlignedSlice<T, alignment, DropExtent(extent, count), stride, padded> DropLast() const {
+    return {Data(), this->Size() - count, this->Stride()};
+  }
+
+  using Base::DropFirst;
+
+  // Stays aligned only when the dropped prefix is a whole number of alignment units
+  template<std::size_t count>
+  auto DropFirst() const {
+    auto rest = Base::template DropFirst<count>();
+
+    if constexpr (stride != dynamic_stride && (count * stride * sizeof(T)) % alignment == 0) {
+      return AlignedSlice<T, alignment, DropExtent(extent, count), stride, padded>(rest);
+    } else {
+      return rest;
+    }
+  }
+
+  AlignedSlice<T, alignment, std::dynamic_extent, dynamic_stride, padded> Skip(std::ptrdiff_t skip) const {
+    return {Data(), DivideRoundUp(this->Size(), skip), this->Stride() * skip};
+  }
+
+  template<std::ptrdiff_t skip>
+  AlignedSlice<T, alignment, SkipExtent(extent, stride, skip), SkipStride(stride, skip), padded> Skip() const {
+    return {Data(), DivideRoundUp(this->Size(), skip), this->Stride() * skip};
+  }
+
+ private:
+  AlignedSlice(T *data, std::size_t count, std::ptrdiff_t skip) : Base(data, count, skip) {}
+
+  explicit AlignedSlice(const Slice<T, extent, stride> &slice) : Base(slice) {}
+};
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <Slice.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <numeric>
+
+// Lock-free shared access to the elements of a Slice: every element is reached through
+// std::atomic_ref, so many threads can scatter into the same buffer without a mutex.
+// The underlying storage is not copied and stays usable as a plain Slice once the threads are done.
+template<class T, std::size_t extent = std::dynamic_extent, std::ptrdiff_t stride = 1>
+class AtomicSlice {
+ public:
+  using element_type = T;
+  using size_type = std::size_t;
+  using reference = std::atomic_ref<T>;
+
+  explicit AtomicSlice(const Slice<T, extent, stride> &slice) : slice_(slice) {
+    assert(reinterpret_cast<std::uintptr_t>(slice.Data()) % reference::required_alignment == 0);
+  }
+
+  [[nodiscard]] size_type Size() const {
+    return slice_.Size();
+  }
+
+  [[nodiscard]] const Slice<T, extent, stride> &Plain() const {
+    return slice_;
+  }
+
+  reference operator[](size_type index) const {
+    return reference(slice_[index]);
+  }
+
+  T Load(size_type index, std::memory_order order = std::memory_order_relaxed) const {
+    return (*this)[index].load(order);
+  }
+
+  void Store(size_type index, T value, std::memory_order order = std::memory_order_relaxed) const {
+    (*this)[index].store(value, order);
+  }
+
+  // Counters and histograms only need the increments not to be lost, hence relaxed by default
+  T FetchAdd(size_type index, T delta, std::memory_order order = std::memory_order_relaxed) const {
+    return (*this)[index].fetch_add(delta, order);
+  }
+
+  bool CompareExchange(size_type index, T &expected, T desired,
+                       std::memory_order order = std::memory_order_acq_rel) const {
+    return (*this)[index].compare_exchange_strong(expected, desired, order, FailureOrder(order));
+  }
+
+ private:
+  static constexpr std::memory_order FailureOrder(std::memory_order order) {
+    if (order == std::memory_order_acq_rel) {
+      return std::memory_order_acquire;
+    }
+
+    if (order == std::memory_order_release) {
+      return std::memory_order_relaxed;
+    }
+
+    return order;
+  }
+
+  Slice<T, extent, stride> slice_;
+};
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+AtomicSlice(const Slice<T, extent, stride> &) -> AtomicSlice<T, extent, stride>;
+
+// Contention-free alternative to AtomicSlice: every writer adds into its own zero-initialised,
+// contiguous copy and Flush folds all copies into the target. The fold runs over unit-stride buffers
+// first so the compiler can vectorize it, and touches the (possibly strided) target only once.
+template<class T, std::size_t extent = std::dynamic_extent, std::ptrdiff_t stride = 1>
+class ShardedSlice {
+ public:
+  ShardedSlice(const Slice<T, extent, stride> &target, std::size_t shards)
+      : target_(target),
+        shards_(shards),
+        shard_stride_(PaddedSize(target.Size())),
+        buffer_(Allocate(shards * shard_stride_)) {}
+
+  [[nodiscard]] std::size_t ShardCount() const {
+    return shards_;
+  }
+
+  // Private to one writer at a time; indices match the target
+  Slice<T> Shard(std::size_t shard) {
+    assert(shard < shards_);
+    return {buffer_.get() + shard * shard_stride_, target_.Size(), 1};
+  }
+
+  // Adds every shard into the target and clears the shards. No writer may be active meanwhile.
+  void Flush() {
+    auto size = target_.Size();
+
+    if (shards_ == 0 || size == 0) {
+      return;
+    }
+
+    T *total = buffer_.get();
+
+    for (std::size_t shard = 1; shard < shards_; ++shard) {
+      T *other = buffer_.get() + shard * shard_stride_;
+
+      for (std::size_t i = 0; i < size; ++i) {
+        total[i] += other[i];
+      }
+    }
+
+    for (std::size_t i = 0; i < size; ++i) {
+      target_[i] += total[i];
+    }
+
+    std::fill_n(buffer_.get(), shards_ * shard_stride_, T{});
+  }
+
+ private:
+  static constexpr std::size_t line = 64;
+  static constexpr std::size_t alignment = std::max(line, alignof(T));
+
+  struct Deleter {
+    std::size_t count;
+
+    void operator()(T *data) const {
+      std::destroy_n(data, count);
+      ::operator delete(data, std::align_val_t{alignment});
+    }
+  };
+
+  // The buffer starts on a cache line and every shard spans whole lines, so the shards start on
+  // lines of their own and neighbouring writers never share one. A size that does not divide the
+  // line is padded to the smallest element count that fills whole lines.
+  static std::size_t PaddedSize(std::size_t size) {
+    constexpr std::size_t elements_per_step = line / std::gcd(line, sizeof(T));
+    return DivideRoundUp(size, elements_per_step) * elements_per_step;
+  }
+
+  static std::unique_ptr<T[], Deleter> Allocate(std::size_t count) {
+    auto *data = static_cast<T *>(::operator new(std::max<std::size_t>(count, 1) * sizeof(T),
+                                                 std::align_val_t{alignment}));
+
+    try {
+      std::uninitialized_value_construct_n(data, count);
+    } catch (...) {
+      ::operator delete(data, std::align_val_t{alignment});
+      throw;
+    }
+
+    return {data, Deleter{count}};
+  }
+
+  Slice<T, extent, stride> target_;
+  std::size_t shards_;
+  std::size_t shard_stride_;
+  std::unique_ptr<T[], Deleter> buffer_;
+};
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+ShardedSlice(const Slice<T, extent, stride> &, std::size_t) -> ShardedSlice<T, extent, stride>;
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <Slice.hpp>
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+enum class AccessPattern {
+  Normal,
+  Sequential,
+  Random,
+  WillNeed,
+};
+
+namespace {
+
+[[noreturn]] inline void ThrowErrno(const char *what, int error) {
+  throw std::system_error(error, std::generic_category(), what);
+}
+
+[[noreturn]] inline void ThrowErrno(const char *what) {
+  ThrowErrno(what, errno);
+}
+
+class FileMapping {
+ public:
+  FileMapping(const std::string &path, bool writable, std::size_t offset) {
+    int fd = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+
+    if (fd < 0) {
+      ThrowErrno("open");
+    }
+
+    struct stat info{};
+
+    // close may fail too and overwrite errno, so the error is saved first
+    if (::fstat(fd, &info) != 0) {
+      int error = errno;
+      ::close(fd);
+      ThrowErrno("fstat", error);
+    }
+
+    auto file_size = static_cast<std::size_t>(info.st_size);
+    auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+    // mmap only accepts page-aligned offsets, the remainder is skipped through the pointer
+    auto aligned_offset = offset / page * page;
+    shift_ = offset - aligned_offset;
+    length_ = file_size > aligned_offset ? file_size - aligned_offset : 0;
+
+    int error = 0;
+
+    if (length_ > shift_) {
+      base_ = ::mmap(nullptr, length_, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd,
+                     static_cast<off_t>(aligned_offset));
+      error = errno;
+    }
+
+    // The mapping keeps the file alive on its own
+    ::close(fd);
+
+    if (base_ == MAP_FAILED) {
+      base_ = nullptr;
+      ThrowErrno("mmap", error);
+    }
+  }
+
+  FileMapping(FileMapping &&other) noexcept
+      : base_(std::exchange(other.base_, nullptr)),
+        length_(std::exchange(other.length_, 0)),
+        shift_(std::exchange(other.shift_, 0)) {}
+
+  FileMapping &operator=(FileMapping &&other) noexcept {
+    std::swap(base_, other.base_);
+    std::swap(length_, other.length_);
+    std::swap(shift_, other.shift_);
+    return *this;
+  }
+
+  ~FileMapping() {
+    if (base_) {
+      ::munmap(base_, length_);
+    }
+  }
+
+  [[nodiscard]] void *Data() const {
+    return base_ ? static_cast<char *>(base_) + shift_ : nullptr;
+  }
+
+  [[nodiscard]] std::size_t Bytes() const {
+    return base_ ? length_ - shift_ : 0;
+  }
+
+  void Advise(AccessPattern pattern) const {
+    static constexpr int advice[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED};
+
+    if (base_ && ::madvise(base_, length_, advice[static_cast<int>(pattern)]) != 0) {
+      ThrowErrno("madvise");
+    }
+  }
+
+  void Sync(bool async) const {
+    if (base_ && ::msync(base_, length_, async ? MS_ASYNC : MS_SYNC) != 0) {
+      ThrowErrno("msync");
+    }
+  }
+
+ private:
+  void *base_ = nullptr;
+  std::size_t length_ = 0;
+  std::size_t shift_ = 0;
+};
+
+} // namespace
+
+// Owning Slice over a file mapped with mmap. A const element type maps the file read-only,
+// otherwise writes go straight to the page cache and reach the disk on Sync or unmap.
+template<class T, std::size_t extent = std::dynamic_extent, std::ptrdiff_t stride = 1>
+requires std::is_trivially_copyable_v<T> && (stride > 0)
+class MappedSlice : public Slice<T, extent, stride> {
+  using Base = Slice<T, extent, stride>;
+
+ public:
+  // `offset` is in bytes from the beginning of the file and a multiple of alignof(T), the view
+  // spans the rest of it
+  explicit MappedSlice(const std::string &path, std::size_t offset = 0)
+      : MappedSlice(FileMapping(path, !std::is_const_v<T>, CheckedOffset(offset))) {}
+
+  MappedSlice(MappedSlice &&) noexcept = default;
+  MappedSlice &operator=(MappedSlice &&) noexcept = default;
+
+  // Ties the kernel's read-ahead to the traversal the caller is about to do
+  void Advise(AccessPattern pattern) const {
+    mapping_.Advise(pattern);
+  }
+
+  void Sync(bool async = false) const requires (!std::is_const_v<T>) {
+    mapping_.Sync(async);
+  }
+
+ private:
+  explicit MappedSlice(FileMapping mapping)
+      : Base(static_cast<T *>(mapping.Data()), ElementCount(mapping.Bytes()), stride),
+        mapping_(std::move(mapping)) {}
+
+  // The mapping itself starts on a page, so an aligned offset gives aligned elements
+  static std::size_t CheckedOffset(std::size_t offset) {
+    if (offset % alignof(T) != 0) {
+      throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                              "offset not aligned for the element type");
+    }
+
+    return offset;
+  }
+
+  static std::size_t ElementCount(std::size_t bytes) {
+    auto elements = bytes / sizeof(T);
+    auto count = DivideRoundUp(elements, static_cast<std::size_t>(stride));
+
+    if (extent != std::dynamic_extent && count < extent) {
+      throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                              "file too small for the static extent");
+    }
+
+    return extent == std::dynamic_extent ? count : extent;
+  }
+
+  FileMapping mapping_;
+};
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <Slice.hpp>
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+template<std::size_t... extents>
+struct Extents {
+  static constexpr std::size_t rank = sizeof...(extents);
+  static constexpr std::array<std::size_t, rank> values{extents...};
+};
+
+template<std::ptrdiff_t... strides>
+struct Strides {
+  static constexpr std::size_t rank = sizeof...(strides);
+  static constexpr std::array<std::ptrdiff_t, rank> values{strides...};
+};
+
+namespace {
+
+template<std::size_t axis, std::size_t extent, std::ptrdiff_t stride>
+class AxisStorage : public ExtentStorage<extent, axis>, public StrideStorage<stride, axis> {
+ public:
+  AxisStorage(std::size_t size, std::ptrdiff_t skip)
+      : ExtentStorage<extent, axis>(size), StrideStorage<stride, axis>(skip) {}
+};
+
+template<typename Axes, typename E, typename S>
+class MultiSliceStorage {
+};
+
+template<std::size_t... axes, std::size_t... extents, std::ptrdiff_t... strides>
+class MultiSliceStorage<std::index_sequence<axes...>, Extents<extents...>, Strides<strides...>>
+    : public AxisStorage<axes, extents, strides> ... {
+ public:
+  MultiSliceStorage(const std::array<std::size_t, sizeof...(axes)> &sizes,
+                    const std::array<std::ptrdiff_t, sizeof...(axes)> &skips)
+      : AxisStorage<axes, extents, strides>(sizes[axes], skips[axes])... {}
+};
+
+template<std::size_t rank>
+consteval std::array<std::ptrdiff_t, rank> DenseStrides(const std::array<std::size_t, rank> &extents,
+                                                        bool row_major) {
+  std::array<std::ptrdiff_t, rank> strides{};
+  std::ptrdiff_t current = 1;
+
+  for (std::size_t step = 0; step < rank; ++step) {
+    auto axis = row_major ? rank - 1 - step : step;
+    strides[axis] = current;
+
+    if (current != dynamic_stride) {
+      current = extents[axis] == std::dynamic_extent ? dynamic_stride
+                                                     : current * static_cast<std::ptrdiff_t>(extents[axis]);
+    }
+  }
+
+  return strides;
+}
+
+template<typename E, bool row_major>
+struct DenseStridesImpl {
+};
+
+template<std::size_t... extents, bool row_major>
+struct DenseStridesImpl<Extents<extents...>, row_major> {
+  static constexpr auto values = DenseStrides<sizeof...(extents)>({extents...}, row_major);
+
+  template<std::size_t... axes>
+  static auto Make(std::index_sequence<axes...>) -> Strides<values[axes]...>;
+
+  using Type = decltype(Make(std::make_index_sequence<sizeof...(extents)>()));
+};
+
+template<std::size_t rank, std::size_t dropped>
+consteval std::array<std::size_t, rank - 1> KeptAxes() {
+  std::array<std::size_t, rank - 1> kept{};
+
+  for (std::size_t axis = 0, out = 0; axis < rank; ++axis) {
+    if (axis != dropped) {
+      kept[out++] = axis;
+    }
+  }
+
+  return kept;
+}
+
+} // namespace
+
+template<typename E>
+using RowMajorStrides = typename DenseStridesImpl<E, true>::Type;
+
+template<typename E>
+using ColumnMajorStrides = typename DenseStridesImpl<E, false>::Type;
+
+template<class T, typename E, typename S = RowMajorStrides<E>>
+class MultiSlice {
+};
+
+template<class T, std::size_t... extents, std::ptrdiff_t... strides>
+requires (sizeof...(extents) == sizeof...(strides)) && (sizeof...(extents) > 0)
+class MultiSlice<T, Extents<extents...>, Strides<strides...>>
+    : public MultiSliceStorage<std::make_index_sequence<sizeof...(extents)>,
+                               Extents<extents...>,
+                               Strides<strides...>> {
+  using Storage = MultiSliceStorage<std::make_index_sequence<sizeof...(extents)>,
+                                    Extents<extents...>,
+                                    Strides<strides...>>;
+
+ public:
+  static constexpr std::size_t rank = sizeof...(extents);
+
+  using element_type = T;
+  using size_type = std::size_t;
+  using index_type = std::array<size_type, rank>;
+  using strides_type = std::array<std::ptrdiff_t, rank>;
+
+  template<std::size_t axis>
+  static constexpr std::size_t static_extent = Extents<extents...>::values[axis];
+
+  template<std::size_t axis>
+  static constexpr std::ptrdiff_t static_stride = Strides<strides...>::values[axis];
+
+  // Which dense layout the stride pack describes, if any; a rank-1 pack counts as row-major
+  static constexpr bool row_major = std::is_same_v<Strides<strides...>, RowMajorStrides<Extents<extents...>>>;
+  static constexpr bool column_major =
+      !row_major && std::is_same_v<Strides<strides...>, ColumnMajorStrides<Extents<extents...>>>;
+
+  MultiSlice() : Storage({extents...}, {strides...}), data_(nullptr) {}
+
+  MultiSlice(T *data, const index_type &sizes, const strides_type &skips)
+      : Storage(sizes, skips), data_(data) {}
+
+  // Dynamic strides are filled in for a dense buffer in the layout of the stride pack; any other
+  // pack has to give every stride statically or pass them explicitly
+  MultiSlice(T *data, const index_type &sizes) requires row_major || column_major || ((strides != dynamic_stride) && ...)
+      : MultiSlice(data, sizes, DenseSkips(sizes)) {}
+
+  template<std::size_t axis> requires (axis < rank)
+  [[nodiscard]] constexpr size_type Extent() const {
+    return static_cast<const ExtentStorage<static_extent<axis>, axis> &>(*this).Size();
+  }
+
+  template<std::size_t axis> requires (axis < rank)
+  [[nodiscard]] constexpr std::ptrdiff_t Stride() const {
+    return static_cast<const StrideStorage<static_stride<axis>, axis> &>(*this).Stride();
+  }
+
+  [[nodiscard]] constexpr size_type Size() const {
+    return ForAxes([this]<std::size_t... axes>() {
+      return (size_type{1} * ... * Extent<axes>());
+    });
+  }
+
+  [[nodiscard]] constexpr T *Data() const {
+    return data_;
+  }
+
+  template<std::convertible_to<size_type>... Indices> requires (sizeof...(Indices) == rank)
+  T &operator()(Indices... indices) const {
+    return data_[Offset({static_cast<size_type>(indices)...})];
+  }
+
+  T &operator[](const index_type &index) const {
+    return data_[Offset(index)];
+  }
+
+  // One-dimensional view along `axis` passing through `origin` (its `axis` coordinate is ignored)
+  template<std::size_t axis> requires (axis < rank)
+  Slice<T, static_extent<axis>, static_stride<axis>> Line(index_type origin) const {
+    origin[axis] = 0;
+    return {data_ + Offset(origin), Extent<axis>(), Stride<axis>()};
+  }
+
+  // Rank-2 helpers return `auto` so that their types are not formed for other ranks
+  auto Row(size_type row) const requires (rank == 2) {
+    return Line<1>({row, 0});
+  }
+
+  auto Column(size_type column) const requires (rank == 2) {
+    return Line<0>({0, column});
+  }
+
+  auto Transposed() const requires (rank == 2) {
+    using Result = MultiSlice<T,
+                              Extents<static_extent<1>, static_extent<0>>,
+                              Strides<static_stride<1>, static_stride<0>>>;
+
+    return Result(data_, {Extent<1>(), Extent<0>()}, {Stride<1>(), Stride<0>()});
+  }
+
+  // View of rank - 1 with the coordinate along `axis` fixed to `index`
+  template<std::size_t axis> requires (axis < rank) && (rank > 1)
+  auto Fix(size_type index) const {
+    constexpr auto kept = KeptAxes<rank, axis>();
+
+    return [&]<std::size_t... out>(std::index_sequence<out...>) {
+      using Result = MultiSlice<T,
+                                Extents<static_extent<kept[out]>...>,
+                                Strides<static_stride<kept[out]>...>>;
+
+      return Result(data_ + static_cast<std::ptrdiff_t>(index) * Stride<axis>(),
+                    {Extent<kept[out]>()...},
+                    {Stride<kept[out]>()...});
+    }(std::make_index_sequence<rank - 1>());
+  }
+
+ private:
+  template<typename F>
+  constexpr auto ForAxes(F &&f) const {
+    return [&]<std::size_t... axes>(std::index_sequence<axes...>) {
+      return f.template operator()<axes...>();
+    }(std::make_index_sequence<rank>());
+  }
+
+  constexpr std::ptrdiff_t Offset(const index_type &index) const {
+    return ForAxes([&]<std::size_t... axes>() {
+      return (std::ptrdiff_t{0} + ... + (static_cast<std::ptrdiff_t>(index[axes]) * Stride<axes>()));
+    });
+  }
+
+  static strides_type DenseSkips(const index_type &sizes) {
+    strides_type skips{};
+    std::ptrdiff_t current = 1;
+
+    for (std::size_t step = 0; step < rank; ++step) {
+      auto axis = column_major ? step : rank - 1 - step;
+      skips[axis] = current;
+      current *= static_cast<std::ptrdiff_t>(sizes[axis]);
+    }
+
+    return skips;
+  }
+
+  T *data_;
+};
@@ -0,0 +1,452 @@
+#pragma once
+
+#include <Slice.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace {
+
+template<std::size_t bits>
+using PackedValue = std::conditional_t<(bits <= 8), std::uint8_t,
+                                       std::conditional_t<(bits <= 16), std::uint16_t,
+                                                          std::conditional_t<(bits <= 32), std::uint32_t,
+                                                                             std::uint64_t>>>;
+
+inline constexpr std::size_t word_bits = 64;
+
+template<std::size_t bits>
+inline constexpr std::uint64_t field_mask = bits == word_bits ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1;
+
+// `value` copied into every field of a word, for widths that tile a word exactly
+template<std::size_t bits>
+constexpr std::uint64_t Broadcast(std::uint64_t value) {
+  std::uint64_t result = 0;
+
+  for (std::size_t shift = 0; shift < word_bits; shift += bits) {
+    result |= (value & field_mask<bits>) << shift;
+  }
+
+  return result;
+}
+
+template<std::size_t bits>
+std::uint64_t Extract(const std::uint64_t *words, std::size_t bit) {
+  auto index = bit / word_bits;
+  auto shift = bit % word_bits;
+  auto value = words[index] >> shift;
+
+  if (shift + bits > word_bits) {
+    value |= words[index + 1] << (word_bits - shift);
+  }
+
+  return value & field_mask<bits>;
+}
+
+template<std::size_t bits>
+void Insert(std::uint64_t *words, std::size_t bit, std::uint64_t value) {
+  auto index = bit / word_bits;
+  auto shift = bit % word_bits;
+  value &= field_mask<bits>;
+
+  words[index] = (words[index] & ~(field_mask<bits> << shift)) | (value << shift);
+
+  if (shift + bits > word_bits) {
+    auto spill = word_bits - shift;
+    words[index + 1] = (words[index + 1] & ~(field_mask<bits> >> spill)) | (value >> spill);
+  }
+}
+
+} // namespace
+
+// View over unsigned `bits`-wide fields packed back to back into 64-bit words, element i living at bit
+// (first bit + i * stride * bits). Elements are read and written through a proxy reference. Static
+// extents and strides cost nothing, as in Slice; the starting bit is kept so that views can begin
+// in the middle of a word.
+template<std::size_t bits, std::size_t extent = std::dynamic_extent, std::ptrdiff_t stride = 1>
+requires (bits > 0) && (bits <= word_bits) && (stride == dynamic_stride || stride > 0)
+class PackedSlice : public ExtentStorage<extent>, public StrideStorage<stride> {
+ public:
+  using Word = std::uint64_t;
+  using value_type = PackedValue<bits>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static constexpr std::size_t bit_width = bits;
+
+  PackedSlice()
+      : ExtentStorage<extent>(extent),
+        StrideStorage<stride>(stride),
+        words_(nullptr),
+        first_bit_(0) {}
+
+  PackedSlice(Word *words, std::size_t count, std::ptrdiff_t skip = stride, std::size_t first_bit = 0)
+      : ExtentStorage<extent>(count),
+        StrideStorage<stride>(skip),
+        words_(words + first_bit / word_bits),
+        first_bit_(first_bit % word_bits) {}
+
+  class reference {
+   public:
+    operator value_type() const {
+      return static_cast<value_type>(Extract<bits>(words_, bit_));
+    }
+
+    reference &operator=(value_type value) {
+      Insert<bits>(words_, bit_, value);
+      return *this;
+    }
+
+    reference &operator=(const reference &other) {
+      return *this = static_cast<value_type>(other);
+    }
+
+   private:
+    friend PackedSlice;
+
+    reference(Word *words, std::size_t bit) : words_(words), bit_(bit) {}
+
+    Word *words_;
+    std::size_t bit_;
+  };
+
+  class iterator : private StrideStorage<stride> {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = PackedSlice::value_type;
+    using reference = PackedSlice::reference;
+
+    friend PackedSlice;
+
+    iterator() : StrideStorage<stride>(stride), words_(nullptr), bit_(0) {}
+
+    reference operator*() const {
+      return {words_, bit_};
+    }
+
+    reference operator[](difference_type n) const {
+      return *(*this + n);
+    }
+
+    iterator &operator++() {
+      bit_ += Step();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator copy(*this);
+      ++(*this);
+      return copy;
+    }
+
+    iterator &operator--() {
+      bit_ -= Step();
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator copy(*this);
+      --(*this);
+      return copy;
+    }
+
+    iterator &operator+=(difference_type n) {
+      bit_ += n * static_cast<difference_type>(Step());
+      return *this;
+    }
+
+    iterator operator+(difference_type n) const {
+      iterator copy(*this);
+      copy += n;
+      return copy;
+    }
+
+    friend iterator operator+(difference_type n, const iterator &other) {
+      return other + n;
+    }
+
+    iterator &operator-=(difference_type n) {
+      return *this += -n;
+    }
+
+    iterator operator-(difference_type n) const {
+      return *this + -n;
+    }
+
+    difference_type operator-(const iterator &other) const {
+      return (static_cast<difference_type>(bit_) - static_cast<difference_type>(other.bit_))
+          / static_cast<difference_type>(Step());
+    }
+
+    auto operator<=>(const iterator &other) const {
+      return bit_ <=> other.bit_;
+    }
+
+    bool operator==(const iterator &other) const {
+      return bit_ == other.bit_;
+    }
+
+   private:
+    iterator(Word *words, std::size_t bit, std::ptrdiff_t skip)
+        : StrideStorage<stride>(skip), words_(words), bit_(bit) {}
+
+    std::size_t Step() const {
+      return static_cast<std::size_t>(this->Stride()) * bits;
+    }
+
+    Word *words_;
+    std::size_t bit_;
+  };
+
+  reference operator[](size_type index) const {
+    return {words_, BitOf(index)};
+  }
+
+  iterator begin() const {
+    return {words_, first_bit_, this->Stride()};
+  }
+
+  iterator end() const {
+    return {words_, BitOf(this->Size()), this->Stride()};
+  }
+
+  [[nodiscard]] Word *Words() const {
+    return words_;
+  }
+
+  // Offset of element 0 inside Words()[0]
+  [[nodiscard]] std::size_t FirstBit() const {
+    return first_bit_;
+  }
+
+  // Element 0 starts a word and the elements are adjacent, which is what the block kernels need
+  [[nodiscard]] bool IsWordAligned() const {
+    return first_bit_ == 0 && this->Stride() == 1;
+  }
+
+  PackedSlice<bits, std::dynamic_extent, stride> First(std::size_t count) const {
+    return {words_, std::min(count, this->Size()), this->Stride(), first_bit_};
+  }
+
+  template<std::size_t count>
+  PackedSlice<bits, count, stride> First() const {
+    return {words_, count, this->Stride(), first_bit_};
+  }
+
+  PackedSlice<bits, std::dynamic_extent, stride> DropFirst(std::size_t count) const {
+    return {words_, this->Size() - count, this->Stride(), BitOf(count)};
+  }
+
+  template<std::size_t count>
+  PackedSlice<bits, DropExtent(extent, count), stride> DropFirst() const {
+    return {words_, this->Size() - count, this->Stride(), BitOf(count)};
+  }
+
+  PackedSlice<bits, std::dynamic_extent, dynamic_stride> Skip(std::ptrdiff_t skip) const {
+    return {words_, DivideRoundUp(this->Size(), skip), this->Stride() * skip, first_bit_};
+  }
+
+  template<std::ptrdiff_t skip>
+  PackedSlice<bits, SkipExtent(extent, stride, skip), SkipStride(stride, skip)> Skip() const {
+    return {words_, DivideRoundUp(this->Size(), skip), this->Stride() * skip, first_bit_};
+  }
+
+ private:
+  std::size_t BitOf(std::size_t index) const {
+    return first_bit_ + index * static_cast<std::size_t>(this->Stride()) * bits;
+  }
+
+  Word *words_;
+  std::size_t first_bit_;
+};
+
+// Kernels over packed data. Word-aligned unit-stride views run in blocks of 64 elements, which span
+// exactly `bits` words, so with a static width every shift and mask is a constant and the block loops
+// unroll and vectorize. Other views fall back to per-element access.
+namespace slice_kernels {
+
+namespace {
+
+inline constexpr std::size_t packed_block = word_bits;
+
+} // namespace
+
+// Widens every element into `destination`, which must hold at least source.Size() elements
+template<std::size_t bits, std::size_t extent, std::ptrdiff_t stride,
+    class T, std::size_t out_extent, std::ptrdiff_t out_stride>
+void Unpack(const PackedSlice<bits, extent, stride> &source, const Slice<T, out_extent, out_stride> &destination) {
+  auto size = source.Size();
+  std::size_t i = 0;
+
+  if (source.IsWordAligned()) {
+    const auto *words = source.Words();
+
+    for (; i + packed_block <= size; i += packed_block, words += bits) {
+      for (std::size_t k = 0; k < packed_block; ++k) {
+        destination[i + k] = static_cast<T>(Extract<bits>(words, k * bits));
+      }
+    }
+  }
+
+  for (; i < size; ++i) {
+    destination[i] = static_cast<T>(source[i]);
+  }
+}
+
+// Narrows source.Size() elements into `destination`, keeping the low `bits` bits of each
+template<class T, std::size_t extent, std::ptrdiff_t stride,
+    std::size_t bits, std::size_t out_extent, std::ptrdiff_t out_stride>
+void Pack(const Slice<T, extent, stride> &source, const PackedSlice<bits, out_extent, out_stride> &destination) {
+  auto size = source.Size();
+  std::size_t i = 0;
+
+  if (destination.IsWordAligned()) {
+    auto *words = destination.Words();
+
+    for (; i + packed_block <= size; i += packed_block, words += bits) {
+      std::uint64_t block[bits] = {};
+
+      for (std::size_t k = 0; k < packed_block; ++k) {
+        auto value = static_cast<std::uint64_t>(source[i + k]) & field_mask<bits>;
+        auto bit = k * bits;
+        auto shift = bit % word_bits;
+
+        block[bit / word_bits] |= value << shift;
+
+        if (shift + bits > word_bits) {
+          block[bit / word_bits + 1] |= value >> (word_bits - shift);
+        }
+      }
+
+      std::copy(block, block + bits, words);
+    }
+  }
+
+  for (; i < size; ++i) {
+    destination[i] = static_cast<typename PackedSlice<bits, out_extent, out_stride>::value_type>(source[i]);
+  }
+}
+
+// Number of set bits over all elements
+template<std::size_t bits, std::size_t extent, std::ptrdiff_t stride>
+std::size_t PopCount(const PackedSlice<bits, extent, stride> &slice) {
+  auto size = slice.Size();
+  std::size_t result = 0;
+
+  if (slice.Stride() == 1) {
+    auto first = slice.FirstBit();
+    auto last = first + size * bits;
+    const auto *words = slice.Words();
+
+    for (auto bit = first; bit < last;) {
+      auto shift = bit % word_bits;
+      auto take = std::min(word_bits - shift, last - bit);
+      auto mask = take == word_bits ? ~std::uint64_t{0} : ((std::uint64_t{1} << take) - 1) << shift;
+
+      result += static_cast<std::size_t>(std::popcount(words[bit / word_bits] & mask));
+      bit += take;
+    }
+  } else {
+    for (std::size_t i = 0; i < size; ++i) {
+      result += static_cast<std::size_t>(std::popcount(static_cast<std::uint64_t>(slice[i])));
+    }
+  }
+
+  return result;
+}
+
+template<std::size_t bits, std::size_t extent, std::ptrdiff_t stride>
+std::uint64_t Sum(const PackedSlice<bits, extent, stride> &slice) {
+  auto size = slice.Size();
+  std::uint64_t result = 0;
+  std::size_t i = 0;
+
+  if (slice.IsWordAligned()) {
+    const auto *words = slice.Words();
+
+    for (; i + packed_block <= size; i += packed_block, words += bits) {
+      for (std::size_t k = 0; k < packed_block; ++k) {
+        result += Extract<bits>(words, k * bits);
+      }
+    }
+  }
+
+  for (; i < size; ++i) {
+    result += slice[i];
+  }
+
+  return result;
+}
+
+// Number of elements equal to `value`. Widths that tile a word compare a whole word per step:
+// fields are XORed with the broadcast value and the non-zero ones detected with carry-free SWAR.
+// A value wider than `bits` matches nothing.
+template<std::size_t bits, std::size_t extent, std::ptrdiff_t stride>
+std::size_t CountEqual(const PackedSlice<bits, extent, stride> &slice, std::uint64_t value) {
+  if (value > field_mask<bits>) {
+    return 0;
+  }
+
+  auto size = slice.Size();
+  std::size_t result = 0;
+  std::size_t i = 0;
+
+  if constexpr (word_bits % bits == 0) {
+    if (slice.IsWordAligned()) {
+      constexpr std::size_t per_word = word_bits / bits;
+      constexpr std::uint64_t high = Broadcast<bits>(std::uint64_t{1} << (bits - 1));
+      constexpr std::uint64_t low = ~high;
+
+      const auto pattern = Broadcast<bits>(value);
+      const auto *words = slice.Words();
+
+      for (; i + per_word <= size; i += per_word, ++words) {
+        auto difference = *words ^ pattern;
+        auto non_zero = (((difference & low) + low) | difference) & high;
+        result += per_word - static_cast<std::size_t>(std::popcount(non_zero));
+      }
+    }
+  }
+
+  for (; i < size; ++i) {
+    result += slice[i] == value;
+  }
+
+  return result;
+}
+
+template<std::size_t bits, std::size_t extent, std::ptrdiff_t stride,
+    std::size_t other_extent, std::ptrdiff_t other_stride>
+bool Equal(const PackedSlice<bits, extent, stride> &left, const PackedSlice<bits, other_extent, other_stride> &right) {
+  if (left.Size() != right.Size()) {
+    return false;
+  }
+
+  auto size = left.Size();
+  std::size_t i = 0;
+
+  if (left.IsWordAligned() && right.IsWordAligned()) {
+    auto full_words = size * bits / word_bits;
+
+    if (!std::equal(left.Words(), left.Words() + full_words, right.Words())) {
+      return false;
+    }
+
+    i = full_words * word_bits / bits;
+  }
+
+  for (; i < size; ++i) {
+    if (left[i] != right[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace slice_kernels
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <Slice.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// Fork-join pool: every worker owns a deque, pops its own work from the back and steals from
+// the front of the others. The thread calling Run helps out while there is work to take, so nested
+// calls from inside a task cannot deadlock, and sleeps once everything left of its batch is running.
+class ThreadPool {
+ public:
+  explicit ThreadPool(std::size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+      : queues_(threads + 1) {
+    for (auto &queue : queues_) {
+      queue = std::make_unique<Queue>();
+    }
+
+    workers_.reserve(threads);
+
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers_.emplace_back([this, i] { WorkerLoop(i); });
+    }
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard lock(sleep_mutex_);
+      stopping_ = true;
+    }
+
+    wake_.notify_all();
+
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  [[nodiscard]] std::size_t Size() const {
+    return workers_.size();
+  }
+
+  // Calls task(i) for every i in [0, count) and blocks until all of them finish.
+  // The first exception thrown by a task is rethrown here.
+  template<typename F>
+  void Run(std::size_t count, F &&task) {
+    std::size_t remaining = count;
+    std::exception_ptr error;
+    std::mutex done_mutex;
+    std::condition_variable done;
+
+    // Counted before publishing so that a fast thief never sees the counter go below zero
+    {
+      std::lock_guard lock(sleep_mutex_);
+      queued_ += count;
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+      auto &queue = *queues_[i % queues_.size()];
+      std::lock_guard lock(queue.mutex);
+
+      queue.tasks.emplace_back([&, i] {
+        std::exception_ptr task_error;
+
+        try {
+          task(i);
+        } catch (...) {
+          task_error = std::current_exception();
+        }
+
+        // Notified under the lock: the waiter cannot return and destroy the batch before that
+        std::lock_guard done_lock(done_mutex);
+
+        if (task_error && !error) {
+          error = task_error;
+        }
+
+        if (--remaining == 0) {
+          done.notify_one();
+        }
+      });
+    }
+
+    wake_.notify_all();
+
+    while (TryRunOne(workers_.size())) {
+    }
+
+    {
+      std::unique_lock done_lock(done_mutex);
+      done.wait(done_lock, [&] { return remaining == 0; });
+    }
+
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::optional<std::function<void()>> Pop(std::size_t index, bool steal) {
+    auto &queue = *queues_[index];
+    std::lock_guard lock(queue.mutex);
+
+    if (queue.tasks.empty()) {
+      return std::nullopt;
+    }
+
+    std::function<void()> task;
+
+    if (steal) {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    } else {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    }
+
+    return task;
+  }
+
+  bool TryRunOne(std::size_t home) {
+    auto task = Pop(home, false);
+
+    for (std::size_t offset = 1; !task && offset < queues_.size(); ++offset) {
+      task = Pop((home + offset) % queues_.size(), true);
+    }
+
+    if (!task) {
+      return false;
+    }
+
+    {
+      std::lock_guard lock(sleep_mutex_);
+      --queued_;
+    }
+
+    (*task)();
+    return true;
+  }
+
+  void WorkerLoop(std::size_t index) {
+    while (true) {
+      if (TryRunOne(index)) {
+        continue;
+      }
+
+      std::unique_lock lock(sleep_mutex_);
+      wake_.wait(lock, [this] { return stopping_ || queued_ > 0; });
+
+      if (stopping_) {
+        return;
+      }
+    }
+  }
+
+  // The last queue is shared by the threads outside the pool
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  std::size_t queued_ = 0;
+  bool stopping_ = false;
+};
+
+inline ThreadPool &DefaultThreadPool() {
+  static ThreadPool pool;
+  return pool;
+}
+
+namespace {
+
+inline constexpr std::size_t cache_line = 64;
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+std::pair<std::uintptr_t, std::uintptr_t> ElementLines(const Slice<T, extent, stride> &slice, std::size_t index) {
+  auto address = reinterpret_cast<std::uintptr_t>(slice.Data() + static_cast<std::ptrdiff_t>(index) * slice.Stride());
+  return {address / cache_line, (address + sizeof(T) - 1) / cache_line};
+}
+
+// Moves `boundary` forward until the elements on both sides of it live on different cache lines.
+// Gives up after a cache line worth of elements for layouts where no such boundary exists,
+// and swallows the rest of the slice when the search runs into its end.
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+std::size_t AlignBoundary(const Slice<T, extent, stride> &slice, std::size_t boundary) {
+  auto limit = std::min(slice.Size(), boundary + cache_line);
+
+  for (auto candidate = boundary; candidate < limit; ++candidate) {
+    auto [before_first, before_last] = ElementLines(slice, candidate - 1);
+    auto [after_first, after_last] = ElementLines(slice, candidate);
+
+    if (before_last < after_first || after_last < before_first) {
+      return candidate;
+    }
+  }
+
+  return limit == slice.Size() ? limit : boundary;
+}
+
+} // namespace
+
+// Splits a slice into chunks of at least `grain` elements whose boundaries never split a cache line.
+// A zero grain picks one that gives each of `workers` threads a few chunks to balance with; zero
+// workers stands for one per hardware thread, so splitting never has to start a pool.
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+std::vector<Slice<T, std::dynamic_extent, stride>> SplitSlice(const Slice<T, extent, stride> &slice,
+                                                              std::size_t grain = 0, std::size_t workers = 0) {
+  constexpr std::size_t chunks_per_worker = 4;
+
+  auto size = slice.Size();
+
+  if (grain == 0) {
+    if (workers == 0) {
+      workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    grain = std::max(cache_line, size / (workers * chunks_per_worker));
+  }
+
+  std::vector<Slice<T, std::dynamic_extent, stride>> chunks;
+
+  for (std::size_t begin = 0; begin < size;) {
+    auto end = begin + grain < size ? AlignBoundary(slice, begin + grain) : size;
+    chunks.push_back(slice.DropFirst(begin).First(end - begin));
+    begin = end;
+  }
+
+  return chunks;
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride, typename F>
+void ParallelForEach(const Slice<T, extent, stride> &slice, F f, std::size_t grain = 0,
+                     ThreadPool &pool = DefaultThreadPool()) {
+  auto chunks = SplitSlice(slice, grain, pool.Size() + 1);
+
+  pool.Run(chunks.size(), [&](std::size_t i) {
+    for (auto &element : chunks[i]) {
+      f(element);
+    }
+  });
+}
+
+// `op` has to be associative: chunks are reduced independently and then combined in order
+template<class T, std::size_t extent, std::ptrdiff_t stride, typename U, typename Op = std::plus<>>
+U ParallelReduce(const Slice<T, extent, stride> &slice, U init, Op op = {}, std::size_t grain = 0,
+                 ThreadPool &pool = DefaultThreadPool()) {
+  auto chunks = SplitSlice(slice, grain, pool.Size() + 1);
+  std::vector<std::optional<U>> partial(chunks.size());
+
+  pool.Run(chunks.size(), [&](std::size_t i) {
+    auto &chunk = chunks[i];
+    U accumulator = chunk[0];
+
+    for (std::size_t k = 1; k < chunk.Size(); ++k) {
+      accumulator = op(std::move(accumulator), chunk[k]);
+    }
+
+    partial[i].emplace(std::move(accumulator));
+  });
+
+  for (auto &value : partial) {
+    init = op(std::move(init), std::move(*value));
+  }
+
+  return init;
+}
+
+// The destination decides the split, so no two workers ever write to the same cache line
+template<class T, std::size_t extent, std::ptrdiff_t stride,
+    class OutT, std::size_t out_extent, std::ptrdiff_t out_stride, typename F>
+void ParallelTransform(const Slice<T, extent, stride> &source, const Slice<OutT, out_extent, out_stride> &destination,
+                       F f, std::size_t grain = 0, ThreadPool &pool = DefaultThreadPool()) {
+  auto count = std::min(source.Size(), destination.Size());
+  auto chunks = SplitSlice(destination.First(count), grain, pool.Size() + 1);
+  auto input = source.First(count);
+
+  pool.Run(chunks.size(), [&](std::size_t i) {
+    auto &chunk = chunks[i];
+    auto offset = static_cast<std::size_t>((chunk.Data() - destination.Data()) / destination.Stride());
+
+    for (std::size_t k = 0; k < chunk.Size(); ++k) {
+      chunk[k] = f(input[offset + k]);
+    }
+  });
+}
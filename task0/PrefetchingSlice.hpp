@@ -0,0 +1,154 @@
+#pragma once
+
+#include <Slice.hpp>
+
+#include <cstdint>
+#include <iterator>
+
+// Slice whose iterator issues a software prefetch `distance` steps ahead on every move forward.
+// Meant for large strides (e.g. a column of a wide row-major table) where every step lands on a new
+// cache line and the hardware prefetcher gives up. Static strides shorter than a cache line are left
+// to the hardware and compile to the plain loop.
+template<std::size_t distance, class T, std::size_t extent = std::dynamic_extent, std::ptrdiff_t stride = 1>
+class PrefetchingSlice : public Slice<T, extent, stride> {
+  using Base = Slice<T, extent, stride>;
+
+  static constexpr bool prefetch = stride == dynamic_stride
+      || static_cast<std::size_t>(stride < 0 ? -stride : stride) * sizeof(T) >= 64;
+
+ public:
+  using Base::Base;
+
+  PrefetchingSlice(const Base &slice) : Base(slice) {}
+
+  class iterator : private StrideStorage<stride> {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::remove_cv_t<T>;
+    using pointer = T *;
+    using reference = T &;
+
+    friend PrefetchingSlice;
+
+    iterator() : StrideStorage<stride>(stride), ptr_(nullptr) {}
+
+    reference operator*() const {
+      return *ptr_;
+    }
+
+    pointer operator->() const {
+      return ptr_;
+    }
+
+    reference operator[](difference_type n) const {
+      return ptr_[n * this->Stride()];
+    }
+
+    iterator &operator++() {
+      ptr_ += this->Stride();
+      Prefetch();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator copy(*this);
+      ++(*this);
+      return copy;
+    }
+
+    iterator &operator--() {
+      ptr_ -= this->Stride();
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator copy(*this);
+      --(*this);
+      return copy;
+    }
+
+    iterator &operator+=(difference_type n) {
+      ptr_ += n * this->Stride();
+      Prefetch();
+      return *this;
+    }
+
+    iterator operator+(difference_type n) const {
+      iterator copy(*this);
+      copy += n;
+      return copy;
+    }
+
+    friend iterator operator+(difference_type n, const iterator &other) {
+      return other + n;
+    }
+
+    iterator &operator-=(difference_type n) {
+      ptr_ -= n * this->Stride();
+      return *this;
+    }
+
+    iterator operator-(difference_type n) const {
+      iterator copy(*this);
+      copy -= n;
+      return copy;
+    }
+
+    difference_type operator-(const iterator &other) const {
+      return (this->ptr_ - other.ptr_) / this->Stride();
+    }
+
+    // Ordered by element distance, not by address, so a negative stride still runs begin() < end()
+    std::strong_ordering operator<=>(const iterator &other) const {
+      return (*this - other) <=> 0;
+    }
+
+    bool operator==(const iterator &other) const {
+      return this->ptr_ == other.ptr_;
+    }
+
+   private:
+    iterator(pointer ptr, std::ptrdiff_t skip) : StrideStorage<stride>(skip), ptr_(ptr) {}
+
+    // Covers the whole window so that the first `distance` steps do not miss either
+    void WarmUp() const {
+      if constexpr (prefetch) {
+        for (std::size_t ahead = 0; ahead < distance; ++ahead) {
+          PrefetchAt(static_cast<std::ptrdiff_t>(ahead));
+        }
+      }
+    }
+
+    void Prefetch() const {
+      if constexpr (prefetch) {
+        PrefetchAt(static_cast<std::ptrdiff_t>(distance));
+      }
+    }
+
+    // Done on integers: the target may lie past the end, which prefetch tolerates and pointer arithmetic does not
+    void PrefetchAt(std::ptrdiff_t steps) const {
+      auto address = reinterpret_cast<std::uintptr_t>(ptr_)
+          + static_cast<std::uintptr_t>(steps * this->Stride() * static_cast<std::ptrdiff_t>(sizeof(T)));
+      __builtin_prefetch(reinterpret_cast<const void *>(address), std::is_const_v<T> ? 0 : 1);
+    }
+
+    pointer ptr_;
+  };
+
+  iterator begin() const {
+    iterator first(this->Data(), this->Stride());
+    first.WarmUp();
+    return first;
+  }
+
+  iterator end() const {
+    return iterator(this->Data() + static_cast<std::ptrdiff_t>(this->Size()) * this->Stride(), this->Stride());
+  }
+};
+
+// The prefetch distance counts iterator steps, so it stays the same whatever the stride is
+template<std::size_t distance = 8, class T, std::size_t extent, std::ptrdiff_t stride>
+PrefetchingSlice<distance, T, extent, stride> Prefetching(const Slice<T, extent, stride> &slice) {
+  return slice;
+}
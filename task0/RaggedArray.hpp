@@ -0,0 +1,153 @@
+#pragma once
+
+#include <ParallelSlice.hpp>
+#include <Slice.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+// Variable-length rows stored CSR-style: all values back to back in one buffer plus an offsets
+// array with RowCount() + 1 entries, row i spanning [offsets[i], offsets[i + 1]). Every row comes out
+// as a Slice, so row code runs on the same kernels as everything else. `Offset` may be narrowed
+// (e.g. to std::uint32_t) to halve the index memory when the total value count fits.
+template<class T, std::unsigned_integral Offset = std::size_t>
+class RaggedArray {
+ public:
+  RaggedArray() : offsets_{0} {}
+
+  // Bulk construction from the length of every row: the offsets are the prefix sums of the lengths
+  // and the values are value-initialised in a single allocation, ready to be filled row by row
+  template<std::ranges::input_range Lengths> requires std::integral<std::ranges::range_value_t<Lengths>>
+  explicit RaggedArray(const Lengths &lengths) : offsets_{0} {
+    if constexpr (std::ranges::sized_range<Lengths>) {
+      offsets_.reserve(std::ranges::size(lengths) + 1);
+    }
+
+    std::size_t total = 0;
+
+    for (auto length : lengths) {
+      total += static_cast<std::size_t>(length);
+      offsets_.push_back(CheckedOffset(total));
+    }
+
+    values_.resize(total);
+  }
+
+  // Copies a nested range such as vector<vector<T>>
+  template<std::ranges::input_range Rows> requires std::ranges::input_range<std::ranges::range_reference_t<Rows>>
+  static RaggedArray FromRows(const Rows &rows) {
+    RaggedArray result;
+
+    for (const auto &row : rows) {
+      result.PushRow(row);
+    }
+
+    return result;
+  }
+
+  // An input range may not know its size up front, so the row is appended first and taken back
+  // when its end does not fit the offset type; the array is left as it was before the call
+  template<std::ranges::input_range Row>
+  void PushRow(const Row &row) {
+    auto old_size = static_cast<std::ptrdiff_t>(values_.size());
+    values_.insert(values_.end(), std::ranges::begin(row), std::ranges::end(row));
+
+    try {
+      offsets_.push_back(CheckedOffset(values_.size()));
+    } catch (...) {
+      values_.erase(values_.begin() + old_size, values_.end());
+      throw;
+    }
+  }
+
+  [[nodiscard]] std::size_t RowCount() const {
+    return offsets_.size() - 1;
+  }
+
+  [[nodiscard]] std::size_t RowSize(std::size_t row) const {
+    return offsets_[row + 1] - offsets_[row];
+  }
+
+  // Total number of values over all rows
+  [[nodiscard]] std::size_t Size() const {
+    return values_.size();
+  }
+
+  Slice<T> operator[](std::size_t row) {
+    return {values_.data() + offsets_[row], RowSize(row), 1};
+  }
+
+  Slice<const T> operator[](std::size_t row) const {
+    return {values_.data() + offsets_[row], RowSize(row), 1};
+  }
+
+  Slice<T> Values() {
+    return {values_.data(), values_.size(), 1};
+  }
+
+  Slice<const T> Values() const {
+    return {values_.data(), values_.size(), 1};
+  }
+
+  Slice<const Offset> Offsets() const {
+    return {offsets_.data(), offsets_.size(), 1};
+  }
+
+  auto Rows() {
+    return std::views::iota(std::size_t{0}, RowCount())
+        | std::views::transform([this](std::size_t row) { return (*this)[row]; });
+  }
+
+  auto Rows() const {
+    return std::views::iota(std::size_t{0}, RowCount())
+        | std::views::transform([this](std::size_t row) { return (*this)[row]; });
+  }
+
+ private:
+  static Offset CheckedOffset(std::size_t offset) {
+    if (offset > std::numeric_limits<Offset>::max()) {
+      throw std::length_error("RaggedArray: total size does not fit the offset type");
+    }
+
+    return static_cast<Offset>(offset);
+  }
+
+  std::vector<T> values_;
+  std::vector<Offset> offsets_;
+};
+
+// Calls f(row_index, row) for every row on `pool`. Rows are grouped into chunks holding about the
+// same number of values rather than the same number of rows, so a few long rows do not end up on a
+// single worker. `grain` is the minimal value count per chunk; zero picks one from the pool size.
+template<class Ragged, typename F>
+void ParallelForEachRow(Ragged &ragged, F f, std::size_t grain = 0, ThreadPool &pool = DefaultThreadPool()) {
+  constexpr std::size_t chunks_per_worker = 4;
+
+  auto offsets = ragged.Offsets();
+  auto rows = ragged.RowCount();
+
+  if (grain == 0) {
+    grain = std::max<std::size_t>(1, ragged.Size() / ((pool.Size() + 1) * chunks_per_worker));
+  }
+
+  std::vector<std::size_t> bounds{0};
+
+  while (bounds.back() < rows) {
+    auto begin = bounds.back();
+    auto target = offsets[begin] + grain;
+    auto it = std::upper_bound(offsets.begin() + static_cast<std::ptrdiff_t>(begin + 1), offsets.end(), target);
+    // Always take at least one row, even one longer than the grain
+    bounds.push_back(std::max<std::size_t>(begin + 1, static_cast<std::size_t>(it - offsets.begin()) - 1));
+  }
+
+  pool.Run(bounds.size() - 1, [&](std::size_t chunk) {
+    for (auto row = bounds[chunk]; row < bounds[chunk + 1]; ++row) {
+      f(row, ragged[row]);
+    }
+  });
+}
@@ -1,14 +1,19 @@
+#pragma once
+
 #include <span>
 #include <concepts>
 #include <cstdlib>
 #include <array>
 #include <iterator>
+#include <ranges>
 
 inline constexpr std::ptrdiff_t dynamic_stride = -1;
 
 namespace {
 
-template<std::size_t extent>
+// `axis` only tags the base so that a multidimensional view can inherit one storage per axis
+// without two identical empty bases forcing each other to distinct addresses
+template<std::size_t extent, std::size_t axis = 0>
 class ExtentStorage {
  public:
   explicit ExtentStorage(std::size_t) {}
@@ -18,8 +23,8 @@ class ExtentStorage {
   }
 };
 
-template<>
-class ExtentStorage<std::dynamic_extent> {
+template<std::size_t axis>
+class ExtentStorage<std::dynamic_extent, axis> {
  public:
   explicit ExtentStorage(std::size_t extent) : extent_(extent) {}
 
@@ -31,7 +36,7 @@ class ExtentStorage<std::dynamic_extent> {
   std::size_t extent_;
 };
 
-template<std::ptrdiff_t stride>
+template<std::ptrdiff_t stride, std::size_t axis = 0>
 class StrideStorage {
  public:
   explicit StrideStorage(std::ptrdiff_t) {}
@@ -41,8 +46,8 @@ class StrideStorage {
   }
 };
 
-template<>
-class StrideStorage<dynamic_stride> {
+template<std::size_t axis>
+class StrideStorage<dynamic_stride, axis> {
  public:
   explicit StrideStorage(std::ptrdiff_t stride) : stride_(stride) {}
 
@@ -74,6 +79,10 @@ consteval std::ptrdiff_t SkipStride(std::ptrdiff_t stride, std::ptrdiff_t skip)
   return stride == dynamic_stride ? stride : (stride * skip);
 }
 
+consteval std::size_t DropExtent(std::size_t extent, std::size_t count) {
+  return extent == std::dynamic_extent ? extent : extent - count;
+}
+
 
 } // namespace
 
@@ -132,7 +141,11 @@ class Slice : public ExtentStorage<extent>, public StrideStorage<stride> {
 
   class iterator : private StrideStorage<stride> {
    public:
-    using iterator_category = std::contiguous_iterator_tag;
+    // Only a unit stride known at compile time makes the elements adjacent in memory
+    using iterator_category = std::conditional_t<stride == 1,
+                                                 std::contiguous_iterator_tag,
+                                                 std::random_access_iterator_tag>;
+    using iterator_concept = iterator_category;
     using difference_type = std::ptrdiff_t;
     using value_type = std::remove_cv_t<T>;
     using pointer = T *;
@@ -177,7 +190,7 @@ class Slice : public ExtentStorage<extent>, public StrideStorage<stride> {
     }
 
     iterator &operator+=(difference_type n) {
-      ptr_ += n;
+      ptr_ += n * this->Stride();
       return *this;
     }
 
@@ -194,7 +207,7 @@ class Slice : public ExtentStorage<extent>, public StrideStorage<stride> {
     }
 
     iterator &operator-=(difference_type n) {
-      ptr_ -= n;
+      ptr_ -= n * this->Stride();
       return *this;
     }
 
@@ -205,11 +218,12 @@ class Slice : public ExtentStorage<extent>, public StrideStorage<stride> {
     }
 
     difference_type operator-(const iterator &other) const {
-      return this->ptr_ - other.ptr_;
+      return (this->ptr_ - other.ptr_) / this->Stride();
     }
 
-    auto operator<=>(const iterator &other) const {
-      return this->ptr_ <=> other.ptr_;
+    // Goes through the distance so that negative strides still order from begin to end
+    std::strong_ordering operator<=>(const iterator &other) const {
+      return (*this - other) <=> 0;
     }
 
     bool operator==(const iterator &other) const {
@@ -240,11 +254,15 @@ class Slice : public ExtentStorage<extent>, public StrideStorage<stride> {
     return std::make_reverse_iterator(begin());
   }
 
-  friend iterator begin(Slice &slice) {
+  // Templates, so that ADL from a view over a Slice (say filter_view<Slice>) finds nothing to
+  // convert to: checking that conversion asks whether the view is a range, which depends on itself
+  template<std::same_as<Slice> Self>
+  friend iterator begin(Self &slice) {
     return slice.begin();
   }
 
-  friend iterator end(Slice &slice) {
+  template<std::same_as<Slice> Self>
+  friend iterator end(Self &slice) {
     return slice.end();
   }
 
@@ -277,7 +295,7 @@ class Slice : public ExtentStorage<extent>, public StrideStorage<stride> {
   }
 
   template<std::size_t count>
-  Slice<T, extent - count, stride> DropFirst() const {
+  Slice<T, DropExtent(extent, count), stride> DropFirst() const {
     return {data_ + count * this->Stride(), this->Size() - count, this->Stride()};
   }
 
@@ -286,7 +304,7 @@ class Slice : public ExtentStorage<extent>, public StrideStorage<stride> {
   }
 
   template<std::size_t count>
-  Slice<T, extent - count, stride> DropLast() const {
+  Slice<T, DropExtent(extent, count), stride> DropLast() const {
     return {data_, this->Size() - count, this->Stride()};
   }
 
@@ -313,3 +331,14 @@ template<std::contiguous_iterator It>
 Slice(It, std::size_t, std::ptrdiff_t) -> Slice<typename It::value_type,
                                                 std::dynamic_extent,
                                                 dynamic_stride>;
+
+namespace std::ranges {
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+inline constexpr bool enable_view<Slice<T, extent, stride>> = true;
+
+// A Slice never owns its elements, so iterators obtained from a temporary stay valid
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+inline constexpr bool enable_borrowed_range<Slice<T, extent, stride>> = true;
+
+} // namespace std::ranges
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <Slice.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Number of elements moved per inner loop of a strided copy: fixed trip count lets the compiler
+// unroll it and keep the constant strides in registers
+inline constexpr std::size_t copy_block = 64;
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+bool IsContiguous(const Slice<T, extent, stride> &slice) {
+  if constexpr (stride == 1) {
+    return true;
+  } else if constexpr (stride == dynamic_stride) {
+    return slice.Stride() == 1 || slice.Size() <= 1;
+  } else {
+    return slice.Size() <= 1;
+  }
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+std::pair<std::uintptr_t, std::uintptr_t> AddressRange(const Slice<T, extent, stride> &slice,
+                                                       std::size_t count) {
+  auto first = reinterpret_cast<std::uintptr_t>(slice.Data());
+  auto last = reinterpret_cast<std::uintptr_t>(slice.Data()
+      + static_cast<std::ptrdiff_t>(count - 1) * slice.Stride());
+
+  return {std::min(first, last), std::max(first, last) + sizeof(T)};
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride,
+    class OtherT, std::size_t other_extent, std::ptrdiff_t other_stride>
+bool Overlap(const Slice<T, extent, stride> &left,
+             const Slice<OtherT, other_extent, other_stride> &right,
+             std::size_t count) {
+  auto [left_begin, left_end] = AddressRange(left, count);
+  auto [right_begin, right_end] = AddressRange(right, count);
+
+  return left_begin < right_end && right_begin < left_end;
+}
+
+template<std::ptrdiff_t from_stride, std::ptrdiff_t to_stride, typename From, typename To, typename Op>
+void BlockedForward(From *from, std::ptrdiff_t from_step, To *to, std::ptrdiff_t to_step, std::size_t count,
+                    Op op) {
+  const std::ptrdiff_t from_skip = from_stride == dynamic_stride ? from_step : from_stride;
+  const std::ptrdiff_t to_skip = to_stride == dynamic_stride ? to_step : to_stride;
+
+  std::size_t i = 0;
+
+  for (; count - i >= copy_block; i += copy_block) {
+    for (std::size_t k = 0; k < copy_block; ++k) {
+      op(from[static_cast<std::ptrdiff_t>(i + k) * from_skip], to[static_cast<std::ptrdiff_t>(i + k) * to_skip]);
+    }
+  }
+
+  // Fewer than copy_block elements are left; saying so keeps GCC from inventing huge trip counts
+  for (std::size_t k = 0; k < copy_block && i + k < count; ++k) {
+    op(from[static_cast<std::ptrdiff_t>(i + k) * from_skip], to[static_cast<std::ptrdiff_t>(i + k) * to_skip]);
+  }
+}
+
+template<typename From, typename To, typename Op>
+void Backward(From *from, std::ptrdiff_t from_step, To *to, std::ptrdiff_t to_step, std::size_t count, Op op) {
+  for (std::size_t i = count; i-- > 0;) {
+    op(from[static_cast<std::ptrdiff_t>(i) * from_step], to[static_cast<std::ptrdiff_t>(i) * to_step]);
+  }
+}
+
+struct CopyOp {
+  template<typename From, typename To>
+  void operator()(From &from, To &to) const {
+    to = from;
+  }
+};
+
+struct MoveOp {
+  template<typename From, typename To>
+  void operator()(From &from, To &to) const {
+    to = std::move(from);
+  }
+};
+
+template<typename Op, class T, std::size_t extent, std::ptrdiff_t stride,
+    class OutT, std::size_t out_extent, std::ptrdiff_t out_stride>
+std::size_t Transfer(const Slice<T, extent, stride> &source,
+                     const Slice<OutT, out_extent, out_stride> &destination,
+                     Op op) {
+  using Value = std::remove_cv_t<T>;
+
+  auto count = std::min(source.Size(), destination.Size());
+
+  if (count == 0) {
+    return 0;
+  }
+
+  auto *from = source.Data();
+  auto *to = destination.Data();
+
+  if constexpr (std::is_same_v<Value, OutT> && std::is_trivially_copyable_v<Value>) {
+    if (IsContiguous(source) && IsContiguous(destination)) {
+      if (Overlap(source, destination, count)) {
+        std::memmove(to, from, count * sizeof(Value));
+      } else {
+        std::memcpy(to, from, count * sizeof(Value));
+      }
+
+      return count;
+    }
+  }
+
+  if (!Overlap(source, destination, count)) {
+    BlockedForward<stride, out_stride>(from, source.Stride(), to, destination.Stride(), count, op);
+  } else if (std::is_same_v<Value, OutT> && source.Stride() == destination.Stride()) {
+    // Same layout: walk away from the side that is about to be overwritten
+    auto ahead = reinterpret_cast<std::uintptr_t>(to) < reinterpret_cast<std::uintptr_t>(from);
+
+    if (ahead == (source.Stride() > 0)) {
+      BlockedForward<stride, out_stride>(from, source.Stride(), to, destination.Stride(), count, op);
+    } else {
+      Backward(from, source.Stride(), to, destination.Stride(), count, op);
+    }
+  } else {
+    // Interleaved layouts can clobber unread elements in either direction, so stage through a buffer
+    std::vector<Value> staged;
+    staged.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      auto &element = from[static_cast<std::ptrdiff_t>(i) * source.Stride()];
+
+      if constexpr (std::is_same_v<Op, MoveOp>) {
+        staged.push_back(std::move(element));
+      } else {
+        staged.push_back(element);
+      }
+    }
+
+    BlockedForward<1, out_stride>(staged.data(), 1, to, destination.Stride(), count, MoveOp{});
+  }
+
+  return count;
+}
+
+} // namespace
+
+// All return the number of elements written: min(source.Size(), destination.Size())
+template<class T, std::size_t extent, std::ptrdiff_t stride,
+    class OutT, std::size_t out_extent, std::ptrdiff_t out_stride>
+std::size_t CopySlice(const Slice<T, extent, stride> &source, const Slice<OutT, out_extent, out_stride> &destination) {
+  return Transfer(source, destination, CopyOp{});
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride,
+    class OutT, std::size_t out_extent, std::ptrdiff_t out_stride>
+std::size_t MoveSlice(const Slice<T, extent, stride> &source, const Slice<OutT, out_extent, out_stride> &destination) {
+  return Transfer(source, destination, MoveOp{});
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+std::size_t FillSlice(const Slice<T, extent, stride> &destination, const std::type_identity_t<T> &value) {
+  auto count = destination.Size();
+
+  if (IsContiguous(destination)) {
+    std::fill_n(destination.Data(), count, value);
+  } else {
+    BlockedForward<0, stride>(&value, 0, destination.Data(), destination.Stride(), count, CopyOp{});
+  }
+
+  return count;
+}
@@ -0,0 +1,443 @@
+#pragma once
+
+#include <AlignedSlice.hpp>
+#include <Slice.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace slice_kernels {
+
+#if defined(__AVX512F__)
+inline constexpr std::size_t vector_bytes = 64;
+#elif defined(__AVX__)
+inline constexpr std::size_t vector_bytes = 32;
+#else
+inline constexpr std::size_t vector_bytes = 16;
+#endif
+
+namespace {
+
+template<typename T>
+concept Vectorizable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+template<Vectorizable T>
+struct VecImpl {
+  typedef T Type __attribute__((vector_size(vector_bytes)));
+};
+
+template<Vectorizable T>
+using Vec = typename VecImpl<T>::Type;
+
+template<Vectorizable T>
+inline constexpr std::size_t lanes = vector_bytes / sizeof(T);
+
+// Contiguous data is loaded as a whole vector, a small static stride becomes a load of
+// `lanes * stride` neighbouring elements that the compiler deinterleaves with shuffles and
+// a dynamic stride is gathered lane by lane
+template<std::ptrdiff_t stride, typename T>
+Vec<std::remove_cv_t<T>> Load(T *data, std::ptrdiff_t step) {
+  using V = Vec<std::remove_cv_t<T>>;
+
+  if constexpr (stride == 1) {
+    V result;
+    std::memcpy(&result, data, sizeof(result));
+    return result;
+  } else {
+    constexpr std::ptrdiff_t static_step = stride;
+
+    return [&]<std::size_t... ls>(std::index_sequence<ls...>) {
+      if constexpr (stride == dynamic_stride) {
+        return V{data[static_cast<std::ptrdiff_t>(ls) * step]...};
+      } else {
+        return V{data[static_cast<std::ptrdiff_t>(ls) * static_step]...};
+      }
+    }(std::make_index_sequence<lanes<std::remove_cv_t<T>>>());
+  }
+}
+
+template<std::ptrdiff_t stride, typename T>
+void Store(T *data, std::ptrdiff_t step, const Vec<T> &value) {
+  if constexpr (stride == 1) {
+    std::memcpy(data, &value, sizeof(value));
+  } else {
+    const std::ptrdiff_t actual_step = stride == dynamic_stride ? step : stride;
+
+    [&]<std::size_t... ls>(std::index_sequence<ls...>) {
+      ((data[static_cast<std::ptrdiff_t>(ls) * actual_step] = value[ls]), ...);
+    }(std::make_index_sequence<lanes<T>>());
+  }
+}
+
+template<typename T, typename Op>
+T Horizontal(const Vec<T> &value, Op op) {
+  T result = value[0];
+
+  for (std::size_t lane = 1; lane < lanes<T>; ++lane) {
+    result = op(result, value[lane]);
+  }
+
+  return result;
+}
+
+template<typename Mask>
+bool AnyLane(const Mask &mask) {
+  constexpr std::size_t count = sizeof(Mask) / sizeof(mask[0]);
+  bool result = false;
+
+  for (std::size_t lane = 0; lane < count; ++lane) {
+    result |= mask[lane] != 0;
+  }
+
+  return result;
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+T *At(const Slice<T, extent, stride> &slice, std::size_t index) {
+  return slice.Data() + static_cast<std::ptrdiff_t>(index) * slice.Stride();
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride, typename Op>
+std::remove_cv_t<T> VectorReduce(const Slice<T, extent, stride> &slice, std::remove_cv_t<T> init, Op op) {
+  using Value = std::remove_cv_t<T>;
+  constexpr std::size_t step = lanes<Value>;
+
+  auto size = slice.Size();
+  std::size_t i = 0;
+
+  if (size >= step) {
+    auto accumulator = Load<stride>(At(slice, 0), slice.Stride());
+
+    for (i = step; i + step <= size; i += step) {
+      accumulator = op(accumulator, Load<stride>(At(slice, i), slice.Stride()));
+    }
+
+    init = op(init, Horizontal<Value>(accumulator, op));
+  }
+
+  for (; i < size; ++i) {
+    init = op(init, *At(slice, i));
+  }
+
+  return init;
+}
+
+struct MinOp {
+  template<typename U>
+  U operator()(const U &a, const U &b) const {
+    return b < a ? b : a;
+  }
+};
+
+struct MaxOp {
+  template<typename U>
+  U operator()(const U &a, const U &b) const {
+    return a < b ? b : a;
+  }
+};
+
+template<typename Op>
+concept MarkedVectorized = requires { typename Op::vectorized; };
+
+// Contiguous AlignedSlices whose alignment covers a whole vector: every vector of the slice is loaded
+// and stored aligned, and with padding the last, partial vector is read in full as well
+template<class T, std::size_t alignment, std::ptrdiff_t stride>
+concept VectorAligned = Vectorizable<std::remove_cv_t<T>> && stride == 1 && alignment >= vector_bytes;
+
+template<typename T>
+Vec<std::remove_cv_t<T>> LoadAligned(T *data) {
+  Vec<std::remove_cv_t<T>> result;
+  std::memcpy(&result, std::assume_aligned<vector_bytes>(data), sizeof(result));
+  return result;
+}
+
+template<typename T>
+void StoreAligned(T *data, const Vec<T> &value) {
+  std::memcpy(std::assume_aligned<vector_bytes>(data), &value, sizeof(value));
+}
+
+// Lanes at and past `count` replaced by `fill`; used on the vector that runs into the padding
+template<typename T>
+Vec<T> KeepLanes(const Vec<T> &value, std::size_t count, const Vec<T> &fill) {
+  constexpr auto indices = []<std::size_t... ls>(std::index_sequence<ls...>) {
+    return Vec<T>{static_cast<T>(ls)...};
+  }(std::make_index_sequence<lanes<T>>());
+
+  return indices < static_cast<T>(count) ? value : fill;
+}
+
+// `fill` has to be neutral for `op`: it seeds the accumulator and stands in for the padding lanes
+template<class T, std::size_t alignment, std::size_t extent, bool padded, typename Op>
+std::remove_cv_t<T> AlignedReduce(const AlignedSlice<T, alignment, extent, 1, padded> &slice,
+                                  std::remove_cv_t<T> init, std::remove_cv_t<T> fill, Op op) {
+  using Value = std::remove_cv_t<T>;
+  constexpr std::size_t step = lanes<Value>;
+
+  auto *data = slice.Data();
+  auto size = slice.Size();
+  auto neutral = Vec<Value>{} + fill;
+  auto accumulator = neutral;
+  std::size_t i = 0;
+
+  for (; i + step <= size; i += step) {
+    accumulator = op(accumulator, LoadAligned(data + i));
+  }
+
+  if constexpr (padded) {
+    if (i < size) {
+      accumulator = op(accumulator, KeepLanes<Value>(LoadAligned(data + i), size - i, neutral));
+    }
+
+    return op(init, Horizontal<Value>(accumulator, op));
+  } else {
+    init = op(init, Horizontal<Value>(accumulator, op));
+
+    for (; i < size; ++i) {
+      init = op(init, data[i]);
+    }
+
+    return init;
+  }
+}
+
+} // namespace
+
+// Marks `op` as callable on whole vectors as well as on single values, so Transform may hand it
+// vectors. Transform never probes an unmarked op with a vector: checking a generic lambda would
+// instantiate its body, and a body that only works on scalars would then fail to compile.
+template<typename Op>
+struct VectorizedOp : Op {
+  using vectorized = void;
+};
+
+template<typename Op>
+VectorizedOp<Op> Vectorized(Op op) {
+  return {std::move(op)};
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+std::remove_cv_t<T> Sum(const Slice<T, extent, stride> &slice) {
+  if constexpr (Vectorizable<std::remove_cv_t<T>>) {
+    return VectorReduce(slice, std::remove_cv_t<T>{}, std::plus<>{});
+  } else {
+    return std::accumulate(slice.begin(), slice.end(), std::remove_cv_t<T>{});
+  }
+}
+
+// Both require a non-empty slice
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+std::remove_cv_t<T> Min(const Slice<T, extent, stride> &slice) {
+  if constexpr (Vectorizable<std::remove_cv_t<T>>) {
+    return VectorReduce(slice, slice[0], MinOp{});
+  } else {
+    return *std::min_element(slice.begin(), slice.end());
+  }
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+std::remove_cv_t<T> Max(const Slice<T, extent, stride> &slice) {
+  if constexpr (Vectorizable<std::remove_cv_t<T>>) {
+    return VectorReduce(slice, slice[0], MaxOp{});
+  } else {
+    return *std::max_element(slice.begin(), slice.end());
+  }
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride,
+    class OtherT, std::size_t other_extent, std::ptrdiff_t other_stride>
+auto Dot(const Slice<T, extent, stride> &left, const Slice<OtherT, other_extent, other_stride> &right) {
+  using Value = std::remove_cv_t<T>;
+  auto size = std::min(left.Size(), right.Size());
+
+  if constexpr (Vectorizable<Value> && std::is_same_v<Value, std::remove_cv_t<OtherT>>) {
+    constexpr std::size_t step = lanes<Value>;
+
+    Vec<Value> accumulator{};
+    std::size_t i = 0;
+
+    for (; i + step <= size; i += step) {
+      accumulator += Load<stride>(At(left, i), left.Stride())
+          * Load<other_stride>(At(right, i), right.Stride());
+    }
+
+    Value result = Horizontal<Value>(accumulator, std::plus<>{});
+
+    for (; i < size; ++i) {
+      result += *At(left, i) * *At(right, i);
+    }
+
+    return result;
+  } else {
+    std::common_type_t<Value, std::remove_cv_t<OtherT>> result{};
+
+    for (std::size_t i = 0; i < size; ++i) {
+      result += *At(left, i) * *At(right, i);
+    }
+
+    return result;
+  }
+}
+
+// Overloads for AlignedSlices that cover whole vectors: no unaligned loads, and a padded slice ends
+// with one more full vector instead of a scalar loop. Padding is only ever read, since a padded view
+// may end in the middle of its buffer.
+template<class T, std::size_t alignment, std::size_t extent, std::ptrdiff_t stride, bool padded>
+requires VectorAligned<T, alignment, stride>
+std::remove_cv_t<T> Sum(const AlignedSlice<T, alignment, extent, stride, padded> &slice) {
+  return AlignedReduce(slice, std::remove_cv_t<T>{}, std::remove_cv_t<T>{}, std::plus<>{});
+}
+
+template<class T, std::size_t alignment, std::size_t extent, std::ptrdiff_t stride, bool padded>
+requires VectorAligned<T, alignment, stride>
+std::remove_cv_t<T> Min(const AlignedSlice<T, alignment, extent, stride, padded> &slice) {
+  return AlignedReduce(slice, slice[0], slice[0], MinOp{});
+}
+
+template<class T, std::size_t alignment, std::size_t extent, std::ptrdiff_t stride, bool padded>
+requires VectorAligned<T, alignment, stride>
+std::remove_cv_t<T> Max(const AlignedSlice<T, alignment, extent, stride, padded> &slice) {
+  return AlignedReduce(slice, slice[0], slice[0], MaxOp{});
+}
+
+template<class T, std::size_t alignment, std::size_t extent, std::ptrdiff_t stride, bool padded,
+    class OtherT, std::size_t other_alignment, std::size_t other_extent, std::ptrdiff_t other_stride, bool other_padded>
+requires VectorAligned<T, alignment, stride> && VectorAligned<OtherT, other_alignment, other_stride>
+    && std::is_same_v<std::remove_cv_t<T>, std::remove_cv_t<OtherT>>
+std::remove_cv_t<T> Dot(const AlignedSlice<T, alignment, extent, stride, padded> &left,
+                        const AlignedSlice<OtherT, other_alignment, other_extent, other_stride, other_padded> &right) {
+  using Value = std::remove_cv_t<T>;
+  constexpr std::size_t step = lanes<Value>;
+
+  auto size = std::min(left.Size(), right.Size());
+  Vec<Value> accumulator{};
+  std::size_t i = 0;
+
+  for (; i + step <= size; i += step) {
+    accumulator += LoadAligned(left.Data() + i) * LoadAligned(right.Data() + i);
+  }
+
+  if constexpr (padded && other_padded) {
+    // Both vectors carry whatever lies past `size`; zeroing only one side would still let an
+    // infinity or NaN in the other turn its product into NaN
+    if (i < size) {
+      accumulator += KeepLanes<Value>(LoadAligned(left.Data() + i), size - i, Vec<Value>{})
+          * KeepLanes<Value>(LoadAligned(right.Data() + i), size - i, Vec<Value>{});
+    }
+
+    return Horizontal<Value>(accumulator, std::plus<>{});
+  } else {
+    Value result = Horizontal<Value>(accumulator, std::plus<>{});
+
+    for (; i < size; ++i) {
+      result += left.Data()[i] * right.Data()[i];
+    }
+
+    return result;
+  }
+}
+
+template<class T, std::size_t alignment, std::size_t extent, std::ptrdiff_t stride, bool padded>
+requires VectorAligned<T, alignment, stride>
+void Fill(const AlignedSlice<T, alignment, extent, stride, padded> &slice, const std::type_identity_t<T> &value) {
+  constexpr std::size_t step = lanes<T>;
+
+  auto *data = slice.Data();
+  auto size = slice.Size();
+  auto broadcast = Vec<T>{} + value;
+  std::size_t i = 0;
+
+  for (; i + step <= size; i += step) {
+    StoreAligned(data + i, broadcast);
+  }
+
+  for (; i < size; ++i) {
+    data[i] = value;
+  }
+}
+
+// `op` is applied to whole vectors only when it opts in through Vectorized, e.g.
+// Transform(source, destination, Vectorized([](auto x) { return x * 2 + 1; }))
+template<class T, std::size_t extent, std::ptrdiff_t stride,
+    class OutT, std::size_t out_extent, std::ptrdiff_t out_stride, typename Op>
+void Transform(const Slice<T, extent, stride> &source, const Slice<OutT, out_extent, out_stride> &destination,
+               Op op) {
+  using Value = std::remove_cv_t<T>;
+  auto size = std::min(source.Size(), destination.Size());
+  std::size_t i = 0;
+
+  if constexpr (Vectorizable<Value> && Vectorizable<OutT>) {
+    if constexpr (MarkedVectorized<Op> && lanes<Value> == lanes<OutT>) {
+      static_assert(std::is_invocable_r_v<Vec<OutT>, Op &, Vec<Value>>,
+                    "An op marked with Vectorized has to accept and return vectors");
+
+      constexpr std::size_t step = lanes<Value>;
+
+      for (; i + step <= size; i += step) {
+        Store<out_stride>(At(destination, i), destination.Stride(),
+                          op(Load<stride>(At(source, i), source.Stride())));
+      }
+    }
+  }
+
+  for (; i < size; ++i) {
+    *At(destination, i) = op(*At(source, i));
+  }
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+void Fill(const Slice<T, extent, stride> &slice, const std::type_identity_t<T> &value) {
+  auto size = slice.Size();
+  std::size_t i = 0;
+
+  if constexpr (Vectorizable<T>) {
+    constexpr std::size_t step = lanes<T>;
+    Vec<T> broadcast = Vec<T>{} + value;
+
+    for (; i + step <= size; i += step) {
+      Store<stride>(At(slice, i), slice.Stride(), broadcast);
+    }
+  }
+
+  for (; i < size; ++i) {
+    *At(slice, i) = value;
+  }
+}
+
+template<class T, std::size_t extent, std::ptrdiff_t stride,
+    class OtherT, std::size_t other_extent, std::ptrdiff_t other_stride>
+bool Equal(const Slice<T, extent, stride> &left, const Slice<OtherT, other_extent, other_stride> &right) {
+  using Value = std::remove_cv_t<T>;
+
+  if (left.Size() != right.Size()) {
+    return false;
+  }
+
+  auto size = left.Size();
+  std::size_t i = 0;
+
+  if constexpr (Vectorizable<Value> && std::is_same_v<Value, std::remove_cv_t<OtherT>>) {
+    constexpr std::size_t step = lanes<Value>;
+
+    for (; i + step <= size; i += step) {
+      if (AnyLane(Load<stride>(At(left, i), left.Stride())
+                      != Load<other_stride>(At(right, i), right.Stride()))) {
+        return false;
+      }
+    }
+  }
+
+  for (; i < size; ++i) {
+    if (!(*At(left, i) == *At(right, i))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace slice_kernels
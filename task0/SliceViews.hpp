@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Slice.hpp>
+
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+// Pipeable adaptors that turn into Slice operations when applied to a Slice, so the result keeps
+// its static extent and stride and stays a Slice for the next stage (and for the Slice kernels).
+// Any other viewable range falls back to the matching std::views adaptor where one exists.
+//
+//   slice | slice_views::skip<2> | slice_views::take(16) | std::views::transform(f)
+namespace slice_views {
+
+namespace {
+
+template<typename T>
+struct IsSliceImpl : std::false_type {
+};
+
+template<class T, std::size_t extent, std::ptrdiff_t stride>
+struct IsSliceImpl<Slice<T, extent, stride>> : std::true_type {
+};
+
+template<typename T>
+concept SliceView = IsSliceImpl<std::remove_cvref_t<T>>::value;
+
+template<typename F>
+struct Closure {
+  F apply;
+
+  template<std::ranges::viewable_range R> requires std::invocable<const F &, R>
+  friend auto operator|(R &&range, const Closure &closure) {
+    return closure.apply(std::forward<R>(range));
+  }
+};
+
+template<typename F>
+Closure(F) -> Closure<F>;
+
+} // namespace
+
+// Runtime counts, like their std::views namesakes
+
+inline constexpr auto take = [](std::size_t count) {
+  return Closure{[count]<typename R>(R &&range) {
+    if constexpr (SliceView<R>) {
+      return range.First(count);
+    } else {
+      return std::forward<R>(range) | std::views::take(static_cast<std::ranges::range_difference_t<R>>(count));
+    }
+  }};
+};
+
+inline constexpr auto drop = [](std::size_t count) {
+  return Closure{[count]<typename R>(R &&range) {
+    if constexpr (SliceView<R>) {
+      return range.DropFirst(std::min(count, range.Size()));
+    } else {
+      return std::forward<R>(range) | std::views::drop(static_cast<std::ranges::range_difference_t<R>>(count));
+    }
+  }};
+};
+
+inline constexpr auto stride = [](std::ptrdiff_t step) {
+  return Closure{[step]<SliceView R>(R &&range) {
+    return range.Skip(step);
+  }};
+};
+
+// Compile-time counts, named after the Slice members they map to. `first` and `drop_first` expect
+// the slice to hold at least `count` elements.
+
+template<std::size_t count>
+inline constexpr auto first = Closure{[]<typename R>(R &&range) {
+  if constexpr (SliceView<R>) {
+    return range.template First<count>();
+  } else {
+    return std::forward<R>(range) | std::views::take(static_cast<std::ranges::range_difference_t<R>>(count));
+  }
+}};
+
+template<std::size_t count>
+inline constexpr auto drop_first = Closure{[]<typename R>(R &&range) {
+  if constexpr (SliceView<R>) {
+    return range.template DropFirst<count>();
+  } else {
+    return std::forward<R>(range) | std::views::drop(static_cast<std::ranges::range_difference_t<R>>(count));
+  }
+}};
+
+template<std::ptrdiff_t step>
+inline constexpr auto skip = Closure{[]<SliceView R>(R &&range) {
+  return range.template Skip<step>();
+}};
+
+} // namespace slice_views
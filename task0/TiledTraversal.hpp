@@ -0,0 +1,129 @@
+#pragma once
+
+#include <MultiSlice.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+
+#include <unistd.h>
+
+struct Tile {
+  std::size_t rows;
+  std::size_t columns;
+};
+
+namespace {
+
+// Smallest L1 data cache we expect to run on, used whenever the answer has to be known at compile time
+inline constexpr std::size_t min_l1_bytes = 32 * 1024;
+inline constexpr std::size_t tile_line_bytes = 64;
+
+inline std::size_t L1DataCacheBytes() {
+  static const std::size_t bytes = [] {
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+    auto probed = ::sysconf(_SC_LEVEL1_DCACHE_SIZE);
+
+    if (probed > 0) {
+      return static_cast<std::size_t>(probed);
+    }
+#endif
+    return min_l1_bytes;
+  }();
+
+  return bytes;
+}
+
+constexpr std::size_t SquareRoot(std::size_t value) {
+  std::size_t root = 0;
+
+  while ((root + 1) * (root + 1) <= value) {
+    ++root;
+  }
+
+  return root;
+}
+
+// Square tile whose two halves (one per view) take half of L1, leaving the rest for everything else.
+// The edge is a whole number of cache lines so that a tile row of either view never drags in a
+// partially used line.
+constexpr Tile ChooseTile(std::size_t rows, std::size_t columns, std::size_t element_bytes,
+                          std::size_t smallest_element, std::size_t l1_bytes) {
+  auto line_elements = std::max<std::size_t>(1, tile_line_bytes / smallest_element);
+  auto edge = SquareRoot(l1_bytes / 2 / element_bytes);
+
+  edge = std::max(line_elements, edge / line_elements * line_elements);
+
+  return {std::min(rows, edge), std::min(columns, edge)};
+}
+
+} // namespace
+
+// Calls f(first(i, j), second(i, j)) for every cell of two equally shaped 2-D views, one L1-sized
+// tile at a time. Fully static views small enough for any L1 are walked in one go; otherwise the
+// tile comes from the probed cache size unless the caller passes one.
+template<class T, typename E, typename S, class U, typename OtherE, typename OtherS, typename F>
+requires (MultiSlice<T, E, S>::rank == 2) && (MultiSlice<U, OtherE, OtherS>::rank == 2)
+void TiledForEach(const MultiSlice<T, E, S> &first, const MultiSlice<U, OtherE, OtherS> &second, F f,
+                  Tile tile = {0, 0}) {
+  using First = MultiSlice<T, E, S>;
+
+  auto rows = first.template Extent<0>();
+  auto columns = first.template Extent<1>();
+
+  assert(rows == second.template Extent<0>() && columns == second.template Extent<1>());
+
+  constexpr std::size_t element_bytes = sizeof(T) + sizeof(U);
+  constexpr bool fully_static = First::template static_extent<0> != std::dynamic_extent
+      && First::template static_extent<1> != std::dynamic_extent;
+
+  if (tile.rows == 0 || tile.columns == 0) {
+    if constexpr (fully_static
+        && First::template static_extent<0> * First::template static_extent<1> * element_bytes <= min_l1_bytes / 2) {
+      tile = {rows, columns};
+    } else {
+      tile = ChooseTile(rows, columns, element_bytes, std::min(sizeof(T), sizeof(U)), L1DataCacheBytes());
+    }
+  }
+
+  // Inside a tile walk the axis along which the two views are closer to contiguous
+  auto distance = [](std::ptrdiff_t a, std::ptrdiff_t b) { return std::abs(a) + std::abs(b); };
+  bool columns_inner = distance(first.template Stride<1>(), second.template Stride<1>())
+      <= distance(first.template Stride<0>(), second.template Stride<0>());
+
+  for (std::size_t row_tile = 0; row_tile < rows; row_tile += tile.rows) {
+    auto row_end = std::min(rows, row_tile + tile.rows);
+
+    for (std::size_t column_tile = 0; column_tile < columns; column_tile += tile.columns) {
+      auto column_end = std::min(columns, column_tile + tile.columns);
+
+      if (columns_inner) {
+        for (auto i = row_tile; i < row_end; ++i) {
+          for (auto j = column_tile; j < column_end; ++j) {
+            f(first(i, j), second(i, j));
+          }
+        }
+      } else {
+        for (auto j = column_tile; j < column_end; ++j) {
+          for (auto i = row_tile; i < row_end; ++i) {
+            f(first(i, j), second(i, j));
+          }
+        }
+      }
+    }
+  }
+}
+
+// destination(i, j) = source(i, j) for views of any layout
+template<class T, typename E, typename S, class U, typename OtherE, typename OtherS>
+void StridedCopy(const MultiSlice<T, E, S> &source, const MultiSlice<U, OtherE, OtherS> &destination,
+                 Tile tile = {0, 0}) {
+  TiledForEach(source, destination, [](const T &from, U &to) { to = from; }, tile);
+}
+
+// destination(j, i) = source(i, j), out of place
+template<class T, typename E, typename S, class U, typename OtherE, typename OtherS>
+void Transpose(const MultiSlice<T, E, S> &source, const MultiSlice<U, OtherE, OtherS> &destination,
+               Tile tile = {0, 0}) {
+  StridedCopy(source, destination.Transposed(), tile);
+}
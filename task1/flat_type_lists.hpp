@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include <type_lists.hpp>
+#include <type_tuples.hpp>
+
+namespace type_lists {
+
+// Finite list that keeps all of its types in one pack. It is an ordinary TypeList (Head/Tail are
+// provided), but indexing, slicing and concatenation work on the pack directly, so their
+// instantiation depth does not grow with the length of the list.
+template<typename... Ts>
+struct FlatList;
+
+template<>
+struct FlatList<> : Nil {
+  static constexpr std::size_t size = 0;
+};
+
+template<typename First, typename... Others>
+struct FlatList<First, Others...> {
+  using Head = First;
+  using Tail = FlatList<Others...>;
+
+  static constexpr std::size_t size = 1 + sizeof...(Others);
+};
+
+namespace {
+
+template<typename T>
+struct IsFlatListImpl : std::false_type {
+};
+
+template<typename... Ts>
+struct IsFlatListImpl<FlatList<Ts...>> : std::true_type {
+};
+
+template<typename... FLs>
+struct FlatConcatImpl {
+  using Type = FlatList<>;
+};
+
+template<typename FL>
+struct FlatConcatImpl<FL> {
+  using Type = FL;
+};
+
+template<typename... Left, typename... Right, typename... Others>
+struct FlatConcatImpl<FlatList<Left...>, FlatList<Right...>, Others...>
+    : FlatConcatImpl<FlatList<Left..., Right...>, Others...> {
+};
+
+template<std::size_t>
+using AnyPointer = const void *;
+
+// Drops N leading types by letting N `const void *` parameters swallow them and deducing the rest
+template<typename Indices>
+struct Skipper;
+
+template<std::size_t... Is>
+struct Skipper<std::index_sequence<Is...>> {
+  template<typename... Rest>
+  static FlatList<typename Rest::type...> Apply(AnyPointer<Is>..., Rest *...);
+};
+
+template<std::size_t N, typename... Ts>
+using SkipPack = decltype(Skipper<std::make_index_sequence<N>>::Apply(
+    static_cast<std::type_identity<Ts> *>(nullptr)...));
+
+// O(1) with the compiler builtin. The fallback resolves an overload against one base per element:
+// still constant in depth, but every lookup is linear in the length of the pack.
+#if __has_builtin(__type_pack_element)
+template<std::size_t I, typename... Ts>
+using PackElement = __type_pack_element<I, Ts...>;
+#else
+template<std::size_t I, typename T>
+struct IndexedType {
+  using Type = T;
+};
+
+template<typename Indices, typename... Ts>
+struct IndexedTypes;
+
+template<std::size_t... Is, typename... Ts>
+struct IndexedTypes<std::index_sequence<Is...>, Ts...> : IndexedType<Is, Ts>... {
+};
+
+template<std::size_t I, typename T>
+IndexedType<I, T> SelectIndexed(const IndexedType<I, T> &);
+
+template<std::size_t I, typename... Ts>
+using PackElement = typename decltype(SelectIndexed<I>(
+    std::declval<IndexedTypes<std::index_sequence_for<Ts...>, Ts...>>()))::Type;
+#endif
+
+template<std::size_t... Is, typename... Ts>
+FlatList<PackElement<Is, Ts...>...> TakeIndices(std::index_sequence<Is...>, FlatList<Ts...>);
+
+template<std::size_t N, typename... Ts>
+using TakePack = decltype(TakeIndices(std::make_index_sequence<N>(), FlatList<Ts...>()));
+
+template<typename FL>
+struct FlatImpl {
+};
+
+template<typename... Ts>
+struct FlatImpl<FlatList<Ts...>> {
+  template<std::size_t I>
+  using At = PackElement<I, Ts...>;
+
+  template<std::size_t N>
+  using Take = TakePack<std::min(N, sizeof...(Ts)), Ts...>;
+
+  template<std::size_t N>
+  using Drop = SkipPack<std::min(N, sizeof...(Ts)), Ts...>;
+};
+
+template<typename TT>
+struct FromTTupleImpl {
+};
+
+template<typename... Ts>
+struct FromTTupleImpl<type_tuples::TTuple<Ts...>> {
+  using Type = FlatList<Ts...>;
+};
+
+template<TypeList TL>
+struct FlattenImpl {
+  using Type = typename FromTTupleImpl<ToTuple<TL>>::Type;
+};
+
+template<typename... Ts>
+struct FlattenImpl<FromTuple<type_tuples::TTuple<Ts...>>> {
+  using Type = FlatList<Ts...>;
+};
+
+template<typename... Ts>
+struct FlattenImpl<FlatList<Ts...>> {
+  using Type = FlatList<Ts...>;
+};
+
+// ToTuple of a flat list is the pack itself
+template<typename... Ts, typename... Prev> requires (sizeof...(Ts) > 0)
+struct ToTupleImpl<FlatList<Ts...>, Prev...> {
+  using Tuple = type_tuples::TTuple<Prev..., Ts...>;
+};
+
+} // namespace
+
+template<typename FL>
+concept FlatTypeList = IsFlatListImpl<FL>::value;
+
+template<FlatTypeList FL>
+constexpr std::size_t FlatSize = FL::size;
+
+template<std::size_t I, FlatTypeList FL> requires (I < FL::size)
+using FlatAt = typename FlatImpl<FL>::template At<I>;
+
+template<std::size_t N, FlatTypeList FL>
+using FlatTake = typename FlatImpl<FL>::template Take<N>;
+
+template<std::size_t N, FlatTypeList FL>
+using FlatDrop = typename FlatImpl<FL>::template Drop<N>;
+
+template<FlatTypeList... FLs>
+using FlatConcat = typename FlatConcatImpl<FLs...>::Type;
+
+// Any finite TypeList as a FlatList; lists made by FromTuple convert without walking them
+template<TypeList TL>
+using Flatten = typename FlattenImpl<TL>::Type;
+
+// The generic algorithms stay flat when given a FlatList
+template<std::size_t N, typename... Ts> requires (N > 0) && (sizeof...(Ts) > 0)
+struct Take<N, FlatList<Ts...>> : FlatTake<N, FlatList<Ts...>> {
+};
+
+template<std::size_t N, typename... Ts> requires (N > 0) && (sizeof...(Ts) > 0)
+struct Drop<N, FlatList<Ts...>> : FlatDrop<N, FlatList<Ts...>> {
+};
+
+template<template<typename> typename MetaFunc, typename... Ts> requires (sizeof...(Ts) > 0)
+struct Map<MetaFunc, FlatList<Ts...>> : FlatList<MetaFunc<Ts>...> {
+};
+
+} // namespace type_lists
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
 #include <value_types.hpp>
 #include <type_lists.hpp>
-#include <commons/metafunctions.hpp>
 
 namespace {
 
@@ -71,4 +74,147 @@ struct IsPrime {
 
 }
 
-using Primes = type_lists::Filter<IsPrime, NatsDividers>;
+// The original definition, kept as a reference and as the baseline in the compile-time benchmarks:
+// every candidate instantiates its own list of dividers, so the first N primes cost O(N^2) templates
+using TrialDivisionPrimes = type_lists::Filter<IsPrime, NatsDividers>;
+
+namespace {
+
+inline constexpr int prime_segment_width = 1024;
+
+// Primes in [low, low + prime_segment_width), found by a constexpr sieve of that window alone:
+// the multiples of every d with d * d below the end of the window are crossed off
+template<int low>
+struct PrimeSegment {
+  static constexpr auto composite = [] {
+    constexpr long long high = static_cast<long long>(low) + prime_segment_width;
+
+    std::array<bool, prime_segment_width> result{};
+
+    for (long long d = 2; d * d < high; ++d) {
+      for (auto multiple = std::max(d * d, (low + d - 1) / d * d); multiple < high; multiple += d) {
+        result[multiple - low] = true;
+      }
+    }
+
+    for (int number = low; number < 2 && number < high; ++number) {
+      result[number - low] = true;
+    }
+
+    return result;
+  }();
+
+  static constexpr std::size_t count = std::count(composite.begin(), composite.end(), false);
+
+  static constexpr auto primes = [] {
+    std::array<int, count> result{};
+
+    for (std::size_t i = 0, out_i = 0; i < composite.size(); ++i) {
+      if (!composite[i]) {
+        result[out_i++] = low + static_cast<int>(i);
+      }
+    }
+
+    return result;
+  }();
+};
+
+// Lazy walk over the segments; a segment is sieved once, when the walk first reaches it
+template<int low, std::size_t index = 0>
+struct SegmentedPrimes {
+  using Head = value_types::ValueTag<PrimeSegment<low>::primes[index]>;
+
+  static constexpr bool last_in_segment = index + 1 == PrimeSegment<low>::count;
+
+  using Tail = SegmentedPrimes<last_in_segment ? low + prime_segment_width : low, last_in_segment ? 0 : index + 1>;
+};
+
+template<int low, std::size_t index> requires (PrimeSegment<low>::count == 0)
+struct SegmentedPrimes<low, index> : SegmentedPrimes<low + prime_segment_width> {
+};
+
+template<std::size_t N, int low, std::size_t index>
+struct DropPrimesImpl {
+  using Type = typename DropPrimesImpl<N - (PrimeSegment<low>::count - index), low + prime_segment_width, 0>::Type;
+};
+
+template<std::size_t N, int low, std::size_t index> requires (index + N < PrimeSegment<low>::count)
+struct DropPrimesImpl<N, low, index> {
+  using Type = SegmentedPrimes<low, index + N>;
+};
+
+} // namespace
+
+// Dropping skips whole segments instead of walking the list one prime at a time
+template<std::size_t N, int low, std::size_t index> requires (N > 0)
+struct type_lists::Drop<N, SegmentedPrimes<low, index>> : DropPrimesImpl<N, low, index>::Type {
+};
+
+namespace {
+
+// Sieve over the odd numbers only (entry i stands for 2i + 1), crossing off one block at a time so
+// that every constexpr loop stays well within the compilers' per-loop iteration limits
+template<std::size_t N>
+constexpr auto OddSieve() {
+  constexpr std::size_t block = 1 << 15;
+  constexpr std::size_t size = (N + 1) / 2;
+
+  std::array<bool, size> composite{};
+
+  if constexpr (size > 0) {
+    composite[0] = true;
+  }
+
+  for (std::size_t begin = 0; begin < size; begin += block) {
+    auto end = std::min(size, begin + block);
+
+    for (std::size_t d = 3; d * d < 2 * end; d += 2) {
+      if (!composite[d / 2]) {
+        // d * d is the first multiple left to cross off; entries of multiples of d are d apart
+        auto first = d * d / 2;
+
+        if (first < begin) {
+          first += (begin - first + d - 1) / d * d;
+        }
+
+        for (auto i = first; i < end; i += d) {
+          composite[i] = true;
+        }
+      }
+    }
+  }
+
+  return composite;
+}
+
+template<std::size_t N>
+inline constexpr auto odd_sieve = OddSieve<N>();
+
+}
+
+// Same infinite list as TrialDivisionPrimes, but the numbers come from a constexpr sieve and only
+// the results are lifted into ValueTags
+using Primes = SegmentedPrimes<0>;
+
+// All primes not greater than N, for runtime lookups. Very large N may need a higher
+// -fconstexpr-ops-limit (GCC) or -fconstexpr-steps (Clang).
+template<std::size_t N>
+inline constexpr auto PrimesUpTo = [] {
+  constexpr auto &composite = odd_sieve<N>;
+  constexpr std::size_t count = (N >= 2) + std::count(composite.begin(), composite.end(), false);
+
+  std::array<std::size_t, count> primes{};
+  std::size_t out_i = 0;
+
+  if constexpr (N >= 2) {
+    primes[out_i++] = 2;
+  }
+
+  for (std::size_t i = 0; i < composite.size(); ++i) {
+    if (!composite[i]) {
+      primes[out_i++] = 2 * i + 1;
+    }
+  }
+
+  return primes;
+}();
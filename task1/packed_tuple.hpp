@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <flat_type_lists.hpp>
+#include <sort_type_lists.hpp>
+
+namespace type_tuples {
+
+namespace {
+
+template<typename T>
+struct AlignmentOf {
+  static constexpr std::size_t Value = alignof(T);
+};
+
+template<std::size_t I, typename T>
+struct PackedLeaf {
+  [[no_unique_address]] T value;
+};
+
+template<typename Order, typename... Ts>
+struct PackedStorage;
+
+// The leaves are bases in storage order, but each one is tagged with its original index
+template<std::size_t... Order, typename... Ts>
+struct PackedStorage<std::index_sequence<Order...>, Ts...>
+    : PackedLeaf<Order, type_lists::FlatAt<Order, type_lists::FlatList<Ts...>>>... {
+  PackedStorage() = default;
+
+  template<typename Arguments>
+  explicit PackedStorage(Arguments &&arguments)
+      : PackedLeaf<Order, type_lists::FlatAt<Order, type_lists::FlatList<Ts...>>>{
+            std::get<Order>(std::forward<Arguments>(arguments))}... {}
+};
+
+template<std::size_t N, const std::array<std::size_t, N> &order>
+struct OrderSequence {
+  template<std::size_t... Is>
+  static std::index_sequence<order[Is]...> Apply(std::index_sequence<Is...>);
+
+  using Type = decltype(Apply(std::make_index_sequence<N>()));
+};
+
+template<typename... Ts>
+using PackedOrder = typename OrderSequence<sizeof...(Ts),
+    type_lists::sort_order<type_lists::FlatList<Ts...>, AlignmentOf, std::greater<>>>::Type;
+
+} // namespace
+
+// Tuple whose members are laid out by decreasing alignment (stable among equal alignments), which
+// leaves no padding between them, while get<I> still refers to the I-th type as written:
+//
+//   sizeof(std::tuple<char, double, char, int>) == 24, sizeof(PackedTuple<char, double, char, int>) == 16
+template<typename... Ts>
+class PackedTuple : private PackedStorage<PackedOrder<Ts...>, Ts...> {
+  using Storage = PackedStorage<PackedOrder<Ts...>, Ts...>;
+
+  template<std::size_t I, typename... Us>
+  friend constexpr auto &get(PackedTuple<Us...> &tuple) noexcept;
+
+  template<std::size_t I, typename... Us>
+  friend constexpr const auto &get(const PackedTuple<Us...> &tuple) noexcept;
+
+  template<std::size_t I, typename... Us>
+  friend constexpr auto &&get(PackedTuple<Us...> &&tuple) noexcept;
+
+  template<std::size_t I, typename... Us>
+  friend constexpr const auto &&get(const PackedTuple<Us...> &&tuple) noexcept;
+
+ public:
+  PackedTuple() = default;
+
+  template<typename... Us> requires (sizeof...(Us) == sizeof...(Ts)) && (sizeof...(Ts) > 0)
+      && (std::is_constructible_v<Ts, Us &&> && ...)
+  explicit(!(std::is_convertible_v<Us &&, Ts> && ...)) PackedTuple(Us &&... values)
+      : Storage(std::forward_as_tuple(std::forward<Us>(values)...)) {}
+
+  bool operator==(const PackedTuple &other) const {
+    return Equal(other, std::index_sequence_for<Ts...>());
+  }
+
+ private:
+  template<std::size_t... Is>
+  bool Equal(const PackedTuple &other, std::index_sequence<Is...>) const {
+    return ((get<Is>(*this) == get<Is>(other)) && ...);
+  }
+};
+
+template<typename... Ts>
+PackedTuple(Ts...) -> PackedTuple<Ts...>;
+
+template<std::size_t I, typename... Us>
+constexpr auto &get(PackedTuple<Us...> &tuple) noexcept {
+  using Leaf = PackedLeaf<I, type_lists::FlatAt<I, type_lists::FlatList<Us...>>>;
+  return static_cast<Leaf &>(static_cast<typename PackedTuple<Us...>::Storage &>(tuple)).value;
+}
+
+template<std::size_t I, typename... Us>
+constexpr const auto &get(const PackedTuple<Us...> &tuple) noexcept {
+  using Leaf = PackedLeaf<I, type_lists::FlatAt<I, type_lists::FlatList<Us...>>>;
+  return static_cast<const Leaf &>(static_cast<const typename PackedTuple<Us...>::Storage &>(tuple)).value;
+}
+
+// Rvalue tuples hand out rvalues, as std::get does; structured bindings of a tuple held by value
+// go through these
+template<std::size_t I, typename... Us>
+constexpr auto &&get(PackedTuple<Us...> &&tuple) noexcept {
+  using Element = type_lists::FlatAt<I, type_lists::FlatList<Us...>>;
+  return std::forward<Element>(get<I>(tuple));
+}
+
+template<std::size_t I, typename... Us>
+constexpr const auto &&get(const PackedTuple<Us...> &&tuple) noexcept {
+  using Element = type_lists::FlatAt<I, type_lists::FlatList<Us...>>;
+  return std::forward<const Element>(get<I>(tuple));
+}
+
+} // namespace type_tuples
+
+template<typename... Ts>
+struct std::tuple_size<type_tuples::PackedTuple<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)> {
+};
+
+template<std::size_t I, typename... Ts>
+struct std::tuple_element<I, type_tuples::PackedTuple<Ts...>> {
+  using type = type_lists::FlatAt<I, type_lists::FlatList<Ts...>>;
+};
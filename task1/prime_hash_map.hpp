@@ -0,0 +1,248 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fun_value_sequences.hpp>
+
+// Capacity ladders for OpenAddressingMap. A ladder hands out Reducers, which map a 32-bit hash
+// onto [0, capacity); growing the table moves to the next step of the ladder.
+
+// Primes just above every power of two. The reduction uses Lemire's fastmod: with
+// magic = ceil(2^64 / p), hash % p is the high half of (magic * hash mod 2^64) * p, so both the
+// constants and the lookups are free of division.
+struct PrimeCapacities {
+  struct Reducer {
+    std::uint32_t capacity;
+    std::uint64_t magic;
+
+    std::uint32_t operator()(std::uint32_t hash) const {
+      auto fraction = magic * hash;
+      return static_cast<std::uint32_t>((static_cast<unsigned __int128>(fraction) * capacity) >> 64);
+    }
+  };
+
+  static constexpr std::size_t steps = 29;
+
+  static constexpr Reducer At(std::size_t step);
+};
+
+struct PowerOfTwoCapacities {
+  struct Reducer {
+    std::uint32_t capacity;
+
+    std::uint32_t operator()(std::uint32_t hash) const {
+      return hash & (capacity - 1);
+    }
+  };
+
+  static constexpr std::size_t steps = 29;
+
+  static constexpr Reducer At(std::size_t step) {
+    return {std::uint32_t{8} << step};
+  }
+};
+
+namespace {
+
+// Trial division by the sieved primes up to sqrt(2^31), enough for every 31-bit candidate
+constexpr std::uint32_t NextPrime(std::uint64_t from) {
+  constexpr auto &divisors = PrimesUpTo<46341>;
+
+  for (auto candidate = from;; ++candidate) {
+    bool prime = candidate > 1;
+
+    for (std::size_t i = 0; prime && i < divisors.size() && divisors[i] * divisors[i] <= candidate; ++i) {
+      prime = candidate % divisors[i] != 0;
+    }
+
+    if (prime) {
+      return static_cast<std::uint32_t>(candidate);
+    }
+  }
+}
+
+inline constexpr auto prime_ladder = [] {
+  std::array<PrimeCapacities::Reducer, PrimeCapacities::steps> ladder{};
+
+  for (std::size_t step = 0; step < ladder.size(); ++step) {
+    auto prime = NextPrime(std::uint64_t{8} << step);
+    ladder[step] = {prime, ~std::uint64_t{0} / prime + 1};
+  }
+
+  return ladder;
+}();
+
+} // namespace
+
+constexpr PrimeCapacities::Reducer PrimeCapacities::At(std::size_t step) {
+  return prime_ladder[step];
+}
+
+// Open-addressing hash map with linear probing. Erasing shifts the rest of the probe run back,
+// so there are no tombstones and lookups never scan past the first empty slot. The table grows to
+// the next capacity of `Capacities` once it is three quarters full.
+template<class Key, class Value, class Capacities = PrimeCapacities, class Hash = std::hash<Key>,
+    class KeyEqual = std::equal_to<Key>>
+class OpenAddressingMap {
+ public:
+  using value_type = std::pair<Key, Value>;
+
+  OpenAddressingMap() : slots_(Capacities::At(0).capacity) {}
+
+  [[nodiscard]] std::size_t Size() const {
+    return size_;
+  }
+
+  [[nodiscard]] bool Empty() const {
+    return size_ == 0;
+  }
+
+  [[nodiscard]] std::size_t Capacity() const {
+    return slots_.size();
+  }
+
+  Value *Find(const Key &key) {
+    auto index = Locate(key);
+    return slots_[index] ? &slots_[index]->second : nullptr;
+  }
+
+  const Value *Find(const Key &key) const {
+    auto index = Locate(key);
+    return slots_[index] ? &slots_[index]->second : nullptr;
+  }
+
+  [[nodiscard]] bool Contains(const Key &key) const {
+    return slots_[Locate(key)].has_value();
+  }
+
+  // Constructs the value from `args` only when `key` is absent, like std::map::try_emplace
+  template<typename... Args>
+  std::pair<Value *, bool> Emplace(const Key &key, Args &&... args) {
+    auto index = Locate(key);
+
+    if (slots_[index]) {
+      return {&slots_[index]->second, false};
+    }
+
+    if ((size_ + 1) * 4 > slots_.size() * 3) {
+      Grow(step_ + 1);
+      index = Locate(key);
+    }
+
+    slots_[index].emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+    ++size_;
+    return {&slots_[index]->second, true};
+  }
+
+  bool Insert(const Key &key, const Value &value) {
+    return Emplace(key, value).second;
+  }
+
+  Value &operator[](const Key &key) {
+    return *Emplace(key).first;
+  }
+
+  bool Erase(const Key &key) {
+    auto hole = Locate(key);
+
+    if (!slots_[hole]) {
+      return false;
+    }
+
+    slots_[hole].reset();
+    --size_;
+
+    // An entry may fill the hole when the hole lies between its home slot and its current slot
+    for (auto index = Next(hole); slots_[index]; index = Next(index)) {
+      auto home = reducer_(HashOf(slots_[index]->first));
+
+      if (Distance(home, index) >= Distance(hole, index)) {
+        slots_[hole] = std::move(slots_[index]);
+        slots_[index].reset();
+        hole = index;
+      }
+    }
+
+    return true;
+  }
+
+  void Reserve(std::size_t count) {
+    auto step = step_;
+
+    // Compared as count > 3/4 capacity, so that a huge count cannot overflow count * 4
+    while (count > static_cast<std::size_t>(Capacities::At(step).capacity) * 3 / 4) {
+      if (++step >= Capacities::steps) {
+        throw std::length_error("OpenAddressingMap: capacity ladder exhausted");
+      }
+    }
+
+    if (step != step_) {
+      Grow(step);
+    }
+  }
+
+  void Clear() {
+    for (auto &slot : slots_) {
+      slot.reset();
+    }
+
+    size_ = 0;
+  }
+
+ private:
+  static std::uint32_t HashOf(const Key &key) {
+    auto hash = static_cast<std::uint64_t>(Hash{}(key));
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+  }
+
+  [[nodiscard]] std::size_t Next(std::size_t index) const {
+    return index + 1 == slots_.size() ? 0 : index + 1;
+  }
+
+  [[nodiscard]] std::size_t Distance(std::size_t from, std::size_t to) const {
+    return to >= from ? to - from : to + slots_.size() - from;
+  }
+
+  // Slot holding `key`, or the empty slot ending its probe run
+  [[nodiscard]] std::size_t Locate(const Key &key) const {
+    std::size_t index = reducer_(HashOf(key));
+
+    while (slots_[index] && !KeyEqual{}(slots_[index]->first, key)) {
+      index = Next(index);
+    }
+
+    return index;
+  }
+
+  void Grow(std::size_t step) {
+    if (step >= Capacities::steps) {
+      throw std::length_error("OpenAddressingMap: capacity ladder exhausted");
+    }
+
+    auto old_slots = std::exchange(slots_, std::vector<std::optional<value_type>>(Capacities::At(step).capacity));
+    step_ = step;
+    reducer_ = Capacities::At(step);
+
+    for (auto &slot : old_slots) {
+      if (slot) {
+        slots_[Locate(slot->first)] = std::move(slot);
+      }
+    }
+  }
+
+  std::vector<std::optional<value_type>> slots_;
+  std::size_t size_ = 0;
+  std::size_t step_ = 0;
+  typename Capacities::Reducer reducer_ = Capacities::At(0);
+};
+
+template<class Key, class Value, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+using PrimeHashMap = OpenAddressingMap<Key, Value, PrimeCapacities, Hash, KeyEqual>;
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <flat_type_lists.hpp>
+#include <type_lists.hpp>
+
+namespace type_lists {
+
+namespace {
+
+// Stable bottom-up merge sort of the positions 0..N-1 by their keys
+template<typename Compare, typename K, std::size_t N>
+constexpr std::array<std::size_t, N> StableOrder(const std::array<K, N> &keys) {
+  std::array<std::size_t, N> order{};
+  std::array<std::size_t, N> buffer{};
+
+  for (std::size_t i = 0; i < N; ++i) {
+    order[i] = i;
+  }
+
+  for (std::size_t width = 1; width < N; width *= 2) {
+    for (std::size_t begin = 0; begin < N; begin += 2 * width) {
+      auto middle = std::min(begin + width, N);
+      auto end = std::min(begin + 2 * width, N);
+      auto left = begin;
+      auto right = middle;
+
+      for (auto out = begin; out < end; ++out) {
+        // Taking from the right only when it is strictly smaller keeps equal keys in order
+        if (right < end && (left == middle || Compare{}(keys[order[right]], keys[order[left]]))) {
+          buffer[out] = order[right++];
+        } else {
+          buffer[out] = order[left++];
+        }
+      }
+    }
+
+    order = buffer;
+  }
+
+  return order;
+}
+
+template<typename FL, template<typename> typename Key, typename Compare>
+struct SortImpl {
+  static constexpr std::array<std::size_t, 0> order{};
+
+  using Type = FL;
+};
+
+template<typename First, typename... Others, template<typename> typename Key, typename Compare>
+struct SortImpl<FlatList<First, Others...>, Key, Compare> {
+  // All keys are compared as the type of the first one
+  using KeyType = std::remove_cv_t<decltype(Key<First>::Value)>;
+
+  static constexpr auto order = StableOrder<Compare>(
+      std::array<KeyType, 1 + sizeof...(Others)>{Key<First>::Value, static_cast<KeyType>(Key<Others>::Value)...});
+
+  template<std::size_t... Is>
+  static FlatList<PackElement<order[Is], First, Others...>...> Apply(std::index_sequence<Is...>);
+
+  using Type = decltype(Apply(std::make_index_sequence<1 + sizeof...(Others)>()));
+};
+
+} // namespace
+
+// Stable sort of a finite TypeList by Key<T>::Value, a constexpr value ordered by Compare. The
+// keys are read once per type and sorted as plain values in a constexpr merge sort, so the sort
+// itself costs O(N log N) constant-evaluation steps and only O(N) instantiations.
+template<TypeList TL, template<typename> typename Key, typename Compare = std::less<>>
+using Sort = typename SortImpl<Flatten<TL>, Key, Compare>::Type;
+
+// Positions in the original list of the elements of Sort<TL, Key, Compare>, in sorted order
+template<TypeList TL, template<typename> typename Key, typename Compare = std::less<>>
+inline constexpr auto sort_order = SortImpl<Flatten<TL>, Key, Compare>::order;
+
+} // namespace type_lists
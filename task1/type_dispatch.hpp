@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <flat_type_lists.hpp>
+#include <type_lists.hpp>
+#include <type_tuples.hpp>
+
+namespace type_lists {
+
+namespace {
+
+template<typename T, typename Visitor>
+decltype(auto) VisitType(Visitor &&visitor) {
+  return std::forward<Visitor>(visitor)(std::type_identity<T>{});
+}
+
+template<typename TT>
+struct DispatchImpl {
+};
+
+template<typename... Ts>
+struct DispatchImpl<type_tuples::TTuple<Ts...>> {
+  static constexpr std::size_t size = sizeof...(Ts);
+
+  // Up to this many types a switch is emitted, which the compiler lowers to a jump table or
+  // a short compare tree, and which lets it inline every case
+  static constexpr std::size_t switch_limit = 8;
+
+  template<typename Visitor>
+  using Result = decltype(VisitType<PackElement<0, Ts...>>(std::declval<Visitor>()));
+
+  template<typename Visitor>
+  static constexpr std::array<Result<Visitor> (*)(Visitor &&), size> table{&VisitType<Ts, Visitor>...};
+
+  template<typename Visitor>
+  static Result<Visitor> Call(std::size_t index, Visitor &&visitor) {
+    static_assert((std::is_same_v<Result<Visitor>, decltype(VisitType<Ts>(std::declval<Visitor>()))> && ...),
+                  "The visitor has to return the same type for every type of the list");
+
+    if constexpr (size <= switch_limit) {
+      switch (index) {
+#define TYPE_LISTS_DISPATCH_CASE(I)                                                   \
+        case I:                                                                       \
+          if constexpr (I < size) {                                                   \
+            return VisitType<PackElement<I, Ts...>>(std::forward<Visitor>(visitor));  \
+          }                                                                           \
+          [[fallthrough]];
+        TYPE_LISTS_DISPATCH_CASE(0)
+        TYPE_LISTS_DISPATCH_CASE(1)
+        TYPE_LISTS_DISPATCH_CASE(2)
+        TYPE_LISTS_DISPATCH_CASE(3)
+        TYPE_LISTS_DISPATCH_CASE(4)
+        TYPE_LISTS_DISPATCH_CASE(5)
+        TYPE_LISTS_DISPATCH_CASE(6)
+        TYPE_LISTS_DISPATCH_CASE(7)
+#undef TYPE_LISTS_DISPATCH_CASE
+        default:
+          __builtin_unreachable();
+      }
+    } else {
+      return table<Visitor>[index](std::forward<Visitor>(visitor));
+    }
+  }
+};
+
+template<TypeList TL>
+using DispatchFor = DispatchImpl<ToTuple<TL>>;
+
+} // namespace
+
+// Calls visitor(std::type_identity<T>{}) for T, the index-th type of the finite list TL, in
+// constant time: short lists become a switch, longer ones an array of function pointers. Every
+// call of the visitor has to return the same type. Throws std::out_of_range on a bad index.
+template<TypeList TL, typename Visitor> requires (DispatchFor<TL>::size > 0)
+decltype(auto) Dispatch(std::size_t index, Visitor &&visitor) {
+  if (index >= DispatchFor<TL>::size) {
+    throw std::out_of_range("type_lists::Dispatch: index out of range");
+  }
+
+  return DispatchFor<TL>::Call(index, std::forward<Visitor>(visitor));
+}
+
+// Same as Dispatch, but an out-of-range index is undefined behaviour (asserted in debug builds),
+// which lets the compiler drop the range check
+template<TypeList TL, typename Visitor> requires (DispatchFor<TL>::size > 0)
+decltype(auto) DispatchUnchecked(std::size_t index, Visitor &&visitor) {
+  assert(index < DispatchFor<TL>::size);
+
+  if (index >= DispatchFor<TL>::size) {
+    __builtin_unreachable();
+  }
+
+  return DispatchFor<TL>::Call(index, std::forward<Visitor>(visitor));
+}
+
+} // namespace type_lists
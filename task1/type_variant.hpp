@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <flat_type_lists.hpp>
+#include <type_dispatch.hpp>
+#include <type_lists.hpp>
+
+namespace type_lists {
+
+template<TypeList TL>
+class Variant;
+
+namespace {
+
+template<typename T, std::size_t extra>
+struct TailPaddingProbe : T {
+  unsigned char bytes[extra];
+};
+
+template<typename T, std::size_t... Ks>
+consteval std::size_t TailPadding(std::index_sequence<Ks...>) {
+  return std::max({std::size_t{0}, (sizeof(TailPaddingProbe<T, Ks + 1>) == sizeof(T) ? Ks + 1 : 0)...});
+}
+
+// Bytes of T that T itself may write. The ABI lets a derived class put members into the tail
+// padding of a non-POD base, so such a class never writes its tail padding and the variant can
+// keep its tag there. For any other type the probe finds no room and the whole object counts.
+template<typename T>
+consteval std::size_t DataSize() {
+  if constexpr (std::is_class_v<T> && !std::is_final_v<T>) {
+    return sizeof(T) - TailPadding<T>(std::make_index_sequence<alignof(T)>());
+  } else {
+    return sizeof(T);
+  }
+}
+
+template<typename FL>
+struct VariantLayout {
+};
+
+template<typename... Ts>
+struct VariantLayout<FlatList<Ts...>> {
+  static constexpr std::size_t count = sizeof...(Ts);
+
+  using Tag = std::conditional_t<count <= 0x100, std::uint8_t,
+                                 std::conditional_t<count <= 0x10000, std::uint16_t, std::uint32_t>>;
+
+  static constexpr std::size_t alignment = std::max({alignof(Ts)...});
+
+  // The tag is accessed through memcpy, so it needs no alignment of its own
+  static constexpr std::size_t tag_offset = std::max({DataSize<Ts>()...});
+
+  static constexpr std::size_t size =
+      (std::max({sizeof(Ts)..., tag_offset + sizeof(Tag)}) + alignment - 1) / alignment * alignment;
+
+  static constexpr bool trivially_copyable = (std::is_trivially_copyable_v<Ts> && ...);
+  static constexpr bool trivially_destructible = (std::is_trivially_destructible_v<Ts> && ...);
+  static constexpr bool copy_constructible = (std::is_copy_constructible_v<Ts> && ...);
+  static constexpr bool nothrow_move_constructible = (std::is_nothrow_move_constructible_v<Ts> && ...);
+
+  // Position of T among the alternatives; count when T is absent or not unique
+  template<typename T>
+  static constexpr std::size_t index_of = [] {
+    constexpr std::array<bool, count> matches{std::is_same_v<T, Ts>...};
+    auto it = std::find(matches.begin(), matches.end(), true);
+    auto index = static_cast<std::size_t>(it - matches.begin());
+    return std::count(matches.begin(), matches.end(), true) == 1 ? index : count;
+  }();
+};
+
+template<typename T>
+struct IsVariantImpl : std::false_type {
+};
+
+template<TypeList TL>
+struct IsVariantImpl<Variant<TL>> : std::true_type {
+};
+
+} // namespace
+
+// Tagged union over the types of a finite TypeList. The tag is the smallest unsigned type that can
+// count the alternatives, and it goes into the tail padding of the alternatives whenever all of
+// them leave enough (see DataSize), so the variant is often no larger than its largest member.
+// Visiting dispatches through Dispatch's jump table. Lists derived with Filter or Map give
+// narrowed variants, and Narrow/the converting constructor move values between them:
+//
+//   using Event = Variant<Events>;
+//   using NetworkEvent = Variant<Filter<IsNetwork, Events>>;
+template<TypeList TL>
+class Variant {
+  using Alternatives = Flatten<TL>;
+  using Layout = VariantLayout<Alternatives>;
+
+  template<TypeList>
+  friend class Variant;
+
+ public:
+  using Tag = typename Layout::Tag;
+
+  static constexpr std::size_t alternatives = Layout::count;
+
+  static_assert(alternatives > 0, "A variant needs at least one alternative");
+
+  template<std::size_t I>
+  using Alternative = FlatAt<I, Alternatives>;
+
+  template<typename T>
+  static constexpr std::size_t index_of = Layout::template index_of<T>;
+
+  Variant() requires std::is_default_constructible_v<Alternative<0>> : Variant(std::in_place_index<0>) {}
+
+  template<std::size_t I, typename... Args>
+  explicit Variant(std::in_place_index_t<I>, Args &&... args) {
+    Construct<I>(std::forward<Args>(args)...);
+  }
+
+  template<typename T> requires (index_of<std::remove_cvref_t<T>> < alternatives)
+  Variant(T &&value) : Variant(std::in_place_index<index_of<std::remove_cvref_t<T>>>, std::forward<T>(value)) {}
+
+  // Widening from a variant whose alternatives all appear here
+  template<TypeList Other> requires (!std::is_same_v<Flatten<Other>, Alternatives>)
+      && (Variant<Other>::template AllIn<Alternatives>())
+  Variant(const Variant<Other> &other) {
+    other.Visit([this]<typename T>(const T &value) {
+      Construct<index_of<T>>(value);
+    });
+  }
+
+  Variant(const Variant &) requires Layout::trivially_copyable = default;
+
+  Variant(const Variant &other) requires (!Layout::trivially_copyable) && Layout::copy_constructible {
+    other.Visit([this, &other]<typename T>(const T &value) {
+      new (storage_) T(value);
+      SetIndex(other.Index());
+    });
+  }
+
+  Variant(Variant &&) requires Layout::trivially_copyable = default;
+
+  Variant(Variant &&other) noexcept(Layout::nothrow_move_constructible) requires (!Layout::trivially_copyable) {
+    other.Visit([this, &other]<typename T>(T &value) {
+      new (storage_) T(std::move(value));
+      SetIndex(other.Index());
+    });
+  }
+
+  Variant &operator=(const Variant &) requires Layout::trivially_copyable = default;
+
+  Variant &operator=(const Variant &other) requires (!Layout::trivially_copyable) && Layout::copy_constructible
+      && Layout::nothrow_move_constructible {
+    if (this != &other) {
+      *this = Variant(other);
+    }
+
+    return *this;
+  }
+
+  Variant &operator=(Variant &&) requires Layout::trivially_copyable = default;
+
+  // The alternatives have to move without throwing, so a variant never ends up empty
+  Variant &operator=(Variant &&other) noexcept requires (!Layout::trivially_copyable)
+      && Layout::nothrow_move_constructible {
+    if (this != &other) {
+      Destroy();
+      other.Visit([this, &other]<typename T>(T &value) {
+        new (storage_) T(std::move(value));
+        SetIndex(other.Index());
+      });
+    }
+
+    return *this;
+  }
+
+  ~Variant() requires Layout::trivially_destructible = default;
+
+  ~Variant() requires (!Layout::trivially_destructible) {
+    Destroy();
+  }
+
+  [[nodiscard]] std::size_t Index() const {
+    Tag tag;
+    std::memcpy(&tag, storage_ + Layout::tag_offset, sizeof(Tag));
+    return tag;
+  }
+
+  template<typename T>
+  [[nodiscard]] bool Holds() const {
+    return Index() == index_of<T>;
+  }
+
+  template<std::size_t I>
+  Alternative<I> &Get() {
+    assert(Index() == I);
+    return *Pointer<Alternative<I>>();
+  }
+
+  template<std::size_t I>
+  const Alternative<I> &Get() const {
+    assert(Index() == I);
+    return *Pointer<Alternative<I>>();
+  }
+
+  template<typename T> requires (index_of<T> < alternatives)
+  T &Get() {
+    return Get<index_of<T>>();
+  }
+
+  template<typename T> requires (index_of<T> < alternatives)
+  const T &Get() const {
+    return Get<index_of<T>>();
+  }
+
+  template<typename T> requires (index_of<T> < alternatives)
+  T *GetIf() {
+    return Holds<T>() ? Pointer<T>() : nullptr;
+  }
+
+  template<typename T> requires (index_of<T> < alternatives)
+  const T *GetIf() const {
+    return Holds<T>() ? Pointer<T>() : nullptr;
+  }
+
+  // A constructor that may throw runs on a temporary first, so on an exception the variant keeps
+  // its old value; only the nothrow move into the storage happens after the old value is gone
+  template<std::size_t I, typename... Args>
+  Alternative<I> &Emplace(Args &&... args) {
+    using T = Alternative<I>;
+
+    if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+      Destroy();
+      Construct<I>(std::forward<Args>(args)...);
+    } else {
+      static_assert(std::is_nothrow_move_constructible_v<T>,
+                    "Emplace needs an alternative that either constructs or moves without throwing");
+
+      T value(std::forward<Args>(args)...);
+      Destroy();
+      Construct<I>(std::move(value));
+    }
+
+    return *Pointer<T>();
+  }
+
+  template<typename T, typename... Args> requires (index_of<T> < alternatives)
+  T &Emplace(Args &&... args) {
+    return Emplace<index_of<T>>(std::forward<Args>(args)...);
+  }
+
+  // Calls visitor(alternative); every call has to return the same type
+  template<typename Visitor>
+  decltype(auto) Visit(Visitor &&visitor) {
+    return DispatchUnchecked<Alternatives>(Index(), [&]<typename T>(std::type_identity<T>) -> decltype(auto) {
+      return std::forward<Visitor>(visitor)(*Pointer<T>());
+    });
+  }
+
+  template<typename Visitor>
+  decltype(auto) Visit(Visitor &&visitor) const {
+    return DispatchUnchecked<Alternatives>(Index(), [&]<typename T>(std::type_identity<T>) -> decltype(auto) {
+      return std::forward<Visitor>(visitor)(*Pointer<T>());
+    });
+  }
+
+  // Copy into a variant over fewer alternatives, or nothing when the current one is not among them
+  template<TypeList Narrowed>
+  std::optional<Variant<Narrowed>> Narrow() const {
+    return Visit([]<typename T>(const T &value) -> std::optional<Variant<Narrowed>> {
+      if constexpr (Variant<Narrowed>::template index_of<T> < Variant<Narrowed>::alternatives) {
+        return Variant<Narrowed>(std::in_place_index<Variant<Narrowed>::template index_of<T>>, value);
+      } else {
+        return std::nullopt;
+      }
+    });
+  }
+
+ private:
+  template<typename FL>
+  static constexpr bool AllIn() {
+    return []<typename... Ts>(FlatList<Ts...> *) {
+      return ((VariantLayout<FL>::template index_of<Ts> < VariantLayout<FL>::count) && ...);
+    }(static_cast<Alternatives *>(nullptr));
+  }
+
+  template<typename T>
+  T *Pointer() {
+    return std::launder(reinterpret_cast<T *>(storage_));
+  }
+
+  template<typename T>
+  const T *Pointer() const {
+    return std::launder(reinterpret_cast<const T *>(storage_));
+  }
+
+  void SetIndex(std::size_t index) {
+    auto tag = static_cast<Tag>(index);
+    std::memcpy(storage_ + Layout::tag_offset, &tag, sizeof(Tag));
+  }
+
+  // The tag is written after the alternative, whose constructor may clobber its own padding
+  template<std::size_t I, typename... Args>
+  void Construct(Args &&... args) {
+    new (storage_) Alternative<I>(std::forward<Args>(args)...);
+    SetIndex(I);
+  }
+
+  void Destroy() {
+    if constexpr (!Layout::trivially_destructible) {
+      Visit([]<typename T>(T &value) {
+        std::destroy_at(&value);
+      });
+    }
+  }
+
+  alignas(Layout::alignment) unsigned char storage_[Layout::size];
+};
+
+template<typename V>
+concept VariantType = IsVariantImpl<std::remove_cvref_t<V>>::value;
+
+template<VariantType V, typename Visitor>
+decltype(auto) Visit(Visitor &&visitor, V &&variant) {
+  return std::forward<V>(variant).Visit(std::forward<Visitor>(visitor));
+}
+
+} // namespace type_lists
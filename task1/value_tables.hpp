@@ -0,0 +1,82 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include <type_lists.hpp>
+#include <type_tuples.hpp>
+#include <value_types.hpp>
+
+namespace value_types {
+
+// Keyed by the values rather than by the list that produced them, so equal sequences share one
+// array no matter how they were generated. Being an inline variable, every translation unit
+// refers to the same read-only copy.
+template<auto... values>
+inline constexpr std::array<std::common_type_t<decltype(values)...>, sizeof...(values)> table_of{values...};
+
+template<>
+inline constexpr std::array<int, 0> table_of<>{};
+
+namespace {
+
+template<typename TT>
+struct TableImpl {
+};
+
+template<typename... Tags>
+struct TableImpl<type_tuples::TTuple<Tags...>> {
+  static constexpr const auto &values = table_of<Tags::Value...>;
+};
+
+} // namespace
+
+// Runtime view of a finite list of ValueTags (bound infinite ones with Take first). Nothing is
+// computed at startup: the array is constant-initialised and lives in read-only data.
+template<type_lists::TypeList TL>
+struct ValueTable {
+  static constexpr const auto &values = TableImpl<type_lists::ToTuple<TL>>::values;
+
+  using value_type = typename std::remove_cvref_t<decltype(values)>::value_type;
+
+  static constexpr std::size_t size = values.size();
+
+  static constexpr bool sorted = std::is_sorted(values.begin(), values.end());
+
+  static constexpr value_type At(std::size_t index) {
+    return values[index];
+  }
+
+  // Index of the first element not less than `value`, or size. The search halves the range with a
+  // conditional move instead of a branch, so its cost does not depend on the data.
+  static constexpr std::size_t LowerBound(value_type value) requires sorted {
+    if constexpr (size == 0) {
+      return 0;
+    } else {
+      const value_type *base = values.data();
+
+      for (std::size_t length = size; length > 1;) {
+        auto half = length / 2;
+        base = base[half] < value ? base + half : base;
+        length -= half;
+      }
+
+      return static_cast<std::size_t>(base - values.data()) + (*base < value);
+    }
+  }
+
+  static constexpr bool Contains(value_type value) requires sorted {
+    auto index = LowerBound(value);
+    return index < size && values[index] == value;
+  }
+
+  // Position of `value`, or size when it is absent
+  static constexpr std::size_t IndexOf(value_type value) requires sorted {
+    auto index = LowerBound(value);
+    return index < size && values[index] == value ? index : size;
+  }
+};
+
+} // namespace value_types
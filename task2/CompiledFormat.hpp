@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <FixedString.hpp>
+
+// How a value of type T is written into a formatted string: MaxSize bounds the characters Write
+// produces for the value. Specialise it to make more types formattable.
+template<typename T>
+struct FormatArgument;
+
+template<>
+struct FormatArgument<bool> {
+  static constexpr std::size_t MaxSize(bool) {
+    return 5;
+  }
+
+  static char *Write(char *out, bool value) {
+    return value ? std::copy_n("true", 4, out) : std::copy_n("false", 5, out);
+  }
+};
+
+template<>
+struct FormatArgument<char> {
+  static constexpr std::size_t MaxSize(char) {
+    return 1;
+  }
+
+  static char *Write(char *out, char value) {
+    *out = value;
+    return out + 1;
+  }
+};
+
+template<typename T> requires std::is_integral_v<T> && (!std::is_same_v<T, bool>) && (!std::is_same_v<T, char>)
+struct FormatArgument<T> {
+  static constexpr std::size_t MaxSize(T) {
+    // digits10 misses the last, partial digit; one more for the sign
+    return std::numeric_limits<T>::digits10 + 2;
+  }
+
+  static char *Write(char *out, T value) {
+    return std::to_chars(out, out + MaxSize(value), value).ptr;
+  }
+};
+
+template<std::floating_point T>
+struct FormatArgument<T> {
+  static constexpr std::size_t MaxSize(T) {
+    // Shortest round-trip form: sign, digits, point, and an exponent of up to five digits
+    return std::numeric_limits<T>::max_digits10 + 9;
+  }
+
+  static char *Write(char *out, T value) {
+    return std::to_chars(out, out + MaxSize(value), value).ptr;
+  }
+};
+
+template<typename T> requires std::is_convertible_v<const T &, std::string_view> && (!std::is_same_v<T, std::nullptr_t>)
+struct FormatArgument<T> {
+  static constexpr std::size_t MaxSize(const T &value) {
+    return std::string_view(value).size();
+  }
+
+  static char *Write(char *out, const T &value) {
+    std::string_view view = value;
+    return std::copy(view.begin(), view.end(), out);
+  }
+};
+
+// Arguments are taken by const reference, so a char array argument is formatted as a const char *
+template<typename T>
+using FormatArgumentFor = FormatArgument<std::decay_t<const T>>;
+
+template<typename T>
+concept Formattable = requires(const T &value, char *out) {
+  { FormatArgumentFor<T>::MaxSize(value) } -> std::convertible_to<std::size_t>;
+  { FormatArgumentFor<T>::Write(out, value) } -> std::same_as<char *>;
+};
+
+namespace {
+
+struct FormatSegment {
+  std::size_t begin;
+  std::size_t length;
+  bool slot;
+};
+
+// Splits a format into literal chunks and {} slots; {{ and }} stand for single braces. Returns the
+// number of segments when `segments` is null. Any other use of a brace fails the evaluation.
+constexpr std::size_t SplitFormat(std::string_view format, FormatSegment *segments) {
+  std::size_t count = 0;
+  std::size_t begin = 0;
+
+  auto add = [&](std::size_t segment_begin, std::size_t length, bool slot) {
+    if (length > 0 || slot) {
+      if (segments) {
+        segments[count] = {segment_begin, length, slot};
+      }
+
+      ++count;
+    }
+  };
+
+  for (std::size_t i = 0; i < format.size(); ++i) {
+    if (format[i] != '{' && format[i] != '}') {
+      continue;
+    }
+
+    if (i + 1 < format.size() && format[i + 1] == format[i]) {
+      // The literal keeps the first brace and resumes after the second
+      add(begin, i + 1 - begin, false);
+      begin = ++i + 1;
+    } else if (format[i] == '{' && i + 1 < format.size() && format[i + 1] == '}') {
+      add(begin, i - begin, false);
+      add(i, 0, true);
+      begin = ++i + 1;
+    } else {
+      throw std::invalid_argument("CompiledFormat: only {} slots and {{, }} escapes are supported");
+    }
+  }
+
+  add(begin, format.size() - begin, false);
+  return count;
+}
+
+} // namespace
+
+// A format string with {} slots, parsed during compilation. Writing a value is a copy of each
+// literal chunk and a FormatArgument::Write per slot, with no parsing and no allocation left at
+// run time. A wrong number of arguments or an argument without a FormatArgument is a compile error.
+template<FixedString format>
+class CompiledFormat {
+  static constexpr std::string_view text = format;
+
+  static constexpr auto segments = [] {
+    std::array<FormatSegment, SplitFormat(text, nullptr)> segments{};
+    SplitFormat(text, segments.data());
+    return segments;
+  }();
+
+  // Argument written by each segment that is a slot
+  static constexpr auto arguments = [] {
+    std::array<std::size_t, segments.size()> arguments{};
+    std::size_t slot = 0;
+
+    for (std::size_t i = 0; i < segments.size(); ++i) {
+      arguments[i] = segments[i].slot ? slot++ : 0;
+    }
+
+    return arguments;
+  }();
+
+  template<typename... Args>
+  static constexpr void CheckArguments() {
+    static_assert(sizeof...(Args) == slots, "The number of arguments has to match the number of {} slots");
+    static_assert((Formattable<Args> && ...), "Every argument needs a FormatArgument specialisation");
+  }
+
+ public:
+  static constexpr std::size_t slots = [] {
+    std::size_t slots = 0;
+
+    for (const auto &segment : segments) {
+      slots += segment.slot;
+    }
+
+    return slots;
+  }();
+
+  static constexpr std::size_t literal_size = [] {
+    std::size_t size = 0;
+
+    for (const auto &segment : segments) {
+      size += segment.length;
+    }
+
+    return size;
+  }();
+
+  // Upper bound of the characters Write produces; exact when all arguments are strings or chars
+  template<typename... Args>
+  static constexpr std::size_t MaxSize(const Args &... args) {
+    CheckArguments<Args...>();
+    return (literal_size + ... + static_cast<std::size_t>(FormatArgumentFor<Args>::MaxSize(args)));
+  }
+
+  // Writes to `out`, which has room for MaxSize(args...) characters, and returns the end
+  template<typename... Args>
+  static char *Write(char *out, const Args &... args) {
+    CheckArguments<Args...>();
+
+    auto values = std::forward_as_tuple(args...);
+
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((out = WriteSegment<Is>(out, values)), ...);
+    }(std::make_index_sequence<segments.size()>());
+
+    return out;
+  }
+
+ private:
+  template<std::size_t I, typename Values>
+  static char *WriteSegment(char *out, const Values &values) {
+    constexpr auto segment = segments[I];
+
+    if constexpr (segment.slot) {
+      using Value = std::remove_reference_t<std::tuple_element_t<arguments[I], Values>>;
+      return FormatArgumentFor<Value>::Write(out, std::get<arguments[I]>(values));
+    } else {
+      std::memcpy(out, text.data() + segment.begin, segment.length);
+      return out + segment.length;
+    }
+  }
+};
+
+template<FixedString format, typename... Args>
+constexpr std::size_t FormattedSize(const Args &... args) {
+  return CompiledFormat<format>::MaxSize(args...);
+}
+
+template<FixedString format, typename... Args>
+char *FormatTo(char *out, const Args &... args) {
+  return CompiledFormat<format>::Write(out, args...);
+}
+
+// Formats into `buffer` and returns the written text. Throws std::length_error when the buffer is
+// smaller than the bound of FormattedSize, even if the text itself would have fit.
+template<FixedString format, typename... Args>
+std::string_view FormatInto(std::span<char> buffer, const Args &... args) {
+  if (buffer.size() < FormattedSize<format>(args...)) {
+    throw std::length_error("FormatInto: buffer smaller than the formatted size bound");
+  }
+
+  return {buffer.data(), static_cast<std::size_t>(FormatTo<format>(buffer.data(), args...) - buffer.data())};
+}
@@ -1,7 +1,18 @@
 #pragma once
 
 #include <string_view>
+#include <cstdint>
 #include <cstring>
+#include <functional>
+
+// 64-bit FNV-1a; the same function hashes FixedStrings at compile time and string_views at run time
+constexpr std::uint64_t HashString(std::string_view string, std::uint64_t seed = 0xcbf29ce484222325) {
+  for (char c : string) {
+    seed = (seed ^ static_cast<unsigned char>(c)) * 0x100000001b3;
+  }
+
+  return seed;
+}
 
 template<std::size_t max_length>
 struct FixedString {
@@ -11,18 +22,81 @@ struct FixedString {
     }
   }
 
+  // Exactly as large as the literal, terminating zero included
+  constexpr FixedString(const char (&string)[max_length]) : FixedString(string, max_length - 1) {}
+
   constexpr ~FixedString() = default;
 
   constexpr operator std::string_view() const {
     return {data, length};
   }
 
+  [[nodiscard]] constexpr std::uint64_t Hash() const {
+    return HashString(*this);
+  }
+
   char data[max_length]{};
   const std::size_t length;
 };
 
+template<std::size_t size>
+FixedString(const char (&)[size]) -> FixedString<size>;
+
 // operator ""_cstr ?
 
 constexpr FixedString<256> operator ""_cstr(const char *c_str, std::size_t length) {
   return {c_str, length};
 }
+
+// Size-exact alternative to _cstr: "name"_fixed is a FixedString<5>
+template<FixedString string>
+consteval auto operator ""_fixed() {
+  return string;
+}
+
+// Hash of a FixedString, guaranteed to be computed during compilation
+template<FixedString string>
+inline constexpr std::uint64_t fixed_string_hash = string.Hash();
+
+struct InternedName {
+  std::string_view name;
+  std::uint64_t hash;
+};
+
+// Keyed by the size-exact copy of a name, so equal names of any capacity share one entry. It has
+// to keep external linkage: one entry per name in the whole program is what makes ids unique.
+template<FixedString exact>
+inline constexpr InternedName interned_name{exact, exact.Hash()};
+
+// Identity of an interned name. Ids of equal names compare equal, ids of different names do not,
+// and comparing two ids compares a single pointer instead of the characters.
+class SymbolId {
+ public:
+  constexpr SymbolId() = default;
+
+  explicit constexpr SymbolId(const InternedName *entry) : entry_(entry) {}
+
+  [[nodiscard]] constexpr std::string_view Name() const {
+    return entry_ ? entry_->name : std::string_view{};
+  }
+
+  [[nodiscard]] constexpr std::uint64_t Hash() const {
+    return entry_ ? entry_->hash : HashString({});
+  }
+
+  constexpr bool operator==(const SymbolId &) const = default;
+
+ private:
+  const InternedName *entry_ = nullptr;
+};
+
+// The interned id of a name, e.g. symbol_id<"requests.total"_fixed> or symbol_id<FixedString{"x"}>
+template<FixedString name>
+inline constexpr SymbolId symbol_id{&interned_name<FixedString<name.length + 1>(name.data, name.length)>};
+
+template<>
+struct std::hash<SymbolId> {
+  std::size_t operator()(const SymbolId &id) const {
+    return static_cast<std::size_t>(id.Hash());
+  }
+};
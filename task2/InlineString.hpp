@@ -0,0 +1,159 @@
+#pragma once
+
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <FixedString.hpp>
+
+// Run-time string of at most max_length characters, stored inline and zero-padded to whole 16-byte
+// blocks. Because the padding is zero and the characters may not be, the blocks alone decide
+// equality, order and hash: each is a handful of vector compares (SSE2 where available, a
+// fixed-size memcmp otherwise) instead of a byte-wise loop, and no length has to be stored.
+template<std::size_t max_length>
+class InlineString {
+ public:
+  static constexpr std::size_t block = 16;
+  static constexpr std::size_t capacity = (max_length + block - 1) / block * block;
+
+  static_assert(max_length > 0, "An InlineString needs room for at least one character");
+
+  constexpr InlineString() = default;
+
+  // Throws std::length_error for more than max_length characters and std::invalid_argument for a
+  // zero character, which would read as the end of the string
+  constexpr InlineString(std::string_view string) {
+    if (string.size() > max_length) {
+      throw std::length_error("InlineString: string longer than max_length");
+    }
+
+    for (std::size_t i = 0; i < string.size(); ++i) {
+      if (string[i] == '\0') {
+        throw std::invalid_argument("InlineString: strings may not contain zero characters");
+      }
+
+      data_[i] = string[i];
+    }
+  }
+
+  template<std::size_t length>
+  constexpr InlineString(const FixedString<length> &string) : InlineString(std::string_view(string)) {}
+
+  [[nodiscard]] constexpr std::size_t Size() const {
+    if (!std::is_constant_evaluated()) {
+#if defined(__SSE2__)
+      for (std::size_t offset = 0; offset < capacity; offset += block) {
+        auto zeros = _mm_movemask_epi8(_mm_cmpeq_epi8(Load(offset), _mm_setzero_si128()));
+
+        if (zeros != 0) {
+          return offset + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(zeros)));
+        }
+      }
+
+      return capacity;
+#endif
+    }
+
+    std::size_t size = 0;
+
+    while (size < capacity && data_[size] != '\0') {
+      ++size;
+    }
+
+    return size;
+  }
+
+  [[nodiscard]] constexpr bool Empty() const {
+    return data_[0] == '\0';
+  }
+
+  [[nodiscard]] constexpr const char *Data() const {
+    return data_;
+  }
+
+  constexpr operator std::string_view() const {
+    return {data_, Size()};
+  }
+
+  [[nodiscard]] constexpr FixedString<max_length> ToFixedString() const {
+    return {data_, Size()};
+  }
+
+  [[nodiscard]] std::uint64_t Hash() const {
+    std::uint64_t hash = capacity;
+
+    for (std::size_t offset = 0; offset < capacity; offset += sizeof(std::uint64_t)) {
+      std::uint64_t word;
+      std::memcpy(&word, data_ + offset, sizeof(word));
+      hash = (hash ^ word) * 0x9e3779b97f4a7c15;
+      hash ^= hash >> 32;
+    }
+
+    return hash;
+  }
+
+  friend constexpr bool operator==(const InlineString &lhs, const InlineString &rhs) {
+    if (!std::is_constant_evaluated()) {
+#if defined(__SSE2__)
+      auto equal = _mm_set1_epi8(-1);
+
+      for (std::size_t offset = 0; offset < capacity; offset += block) {
+        equal = _mm_and_si128(equal, _mm_cmpeq_epi8(lhs.Load(offset), rhs.Load(offset)));
+      }
+
+      return _mm_movemask_epi8(equal) == 0xffff;
+#else
+      return std::memcmp(lhs.data_, rhs.data_, capacity) == 0;
+#endif
+    }
+
+    return std::string_view(lhs.data_, capacity) == std::string_view(rhs.data_, capacity);
+  }
+
+  // Lexicographic by unsigned bytes, like std::string; a proper prefix meets the zero padding first
+  friend constexpr std::strong_ordering operator<=>(const InlineString &lhs, const InlineString &rhs) {
+    if (!std::is_constant_evaluated()) {
+#if defined(__SSE2__)
+      for (std::size_t offset = 0; offset < capacity; offset += block) {
+        auto differ = ~_mm_movemask_epi8(_mm_cmpeq_epi8(lhs.Load(offset), rhs.Load(offset))) & 0xffff;
+
+        if (differ != 0) {
+          auto i = offset + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(differ)));
+          return static_cast<unsigned char>(lhs.data_[i]) <=> static_cast<unsigned char>(rhs.data_[i]);
+        }
+      }
+
+      return std::strong_ordering::equal;
+#else
+      return std::memcmp(lhs.data_, rhs.data_, capacity) <=> 0;
+#endif
+    }
+
+    return std::string_view(lhs.data_, capacity).compare(std::string_view(rhs.data_, capacity)) <=> 0;
+  }
+
+ private:
+#if defined(__SSE2__)
+  __m128i Load(std::size_t offset) const {
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(data_ + offset));
+  }
+#endif
+
+  alignas(block) char data_[capacity]{};
+};
+
+template<std::size_t max_length>
+struct std::hash<InlineString<max_length>> {
+  std::size_t operator()(const InlineString<max_length> &string) const {
+    return static_cast<std::size_t>(string.Hash());
+  }
+};
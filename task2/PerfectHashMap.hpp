@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include <FixedString.hpp>
+
+template<FixedString key, auto target>
+struct StringMapping {
+  static constexpr std::string_view Key = key;
+  static constexpr decltype(target) Value = target;
+};
+
+namespace {
+
+// splitmix64 finalizer; FNV-1a alone leaves its low bits depending on the low bits of each byte
+constexpr std::uint64_t MixHash(std::uint64_t hash) {
+  hash ^= hash >> 31;
+  hash *= 0x7fb5d329728ea185;
+  hash ^= hash >> 27;
+  hash *= 0x81dadef4bc2dd44d;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+template<std::size_t size>
+struct PerfectHashTable {
+  static constexpr std::size_t capacity = std::bit_ceil(size > 0 ? size : 1);
+  static constexpr std::size_t mask = capacity - 1;
+
+  static constexpr std::size_t Bucket(std::uint64_t hash) {
+    return MixHash(hash) & mask;
+  }
+
+  static constexpr std::size_t Slot(std::uint64_t hash, std::uint64_t seed) {
+    return MixHash(hash ^ (seed * 0x9e3779b97f4a7c15)) & mask;
+  }
+
+  // Seed of every bucket, and the entry of every slot. Free slots point at entry 0: its own key
+  // lands in its own slot, so the verifying compare still rejects whatever lands in a free one.
+  std::array<std::uint64_t, capacity> seeds{};
+  std::array<std::uint32_t, capacity> entries{};
+};
+
+template<typename T, std::size_t size>
+constexpr bool AllDistinct(const std::array<T, size> &values) {
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t j = i + 1; j < size; ++j) {
+      if (values[i] == values[j]) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+template<std::size_t size>
+constexpr std::array<std::uint64_t, size> HashKeys(const std::array<std::string_view, size> &keys,
+                                                   std::uint64_t seed) {
+  std::array<std::uint64_t, size> hashes{};
+
+  for (std::size_t i = 0; i < size; ++i) {
+    hashes[i] = HashString(keys[i], seed);
+  }
+
+  return hashes;
+}
+
+// The FNV seed under which distinct keys get distinct 64-bit hashes. The default seed almost
+// always works; a collision between two keys only moves the search on to the next seed.
+template<std::size_t size>
+constexpr std::uint64_t FindHashSeed(const std::array<std::string_view, size> &keys) {
+  std::uint64_t seed = HashString({});
+
+  // Equal keys are reported by the map's own static_assert; no seed can separate them
+  while (AllDistinct(keys) && !AllDistinct(HashKeys(keys, seed))) {
+    ++seed;
+  }
+
+  return seed;
+}
+
+// Hash and displace: keys are split into buckets, and from the largest bucket down every bucket
+// searches for a seed that sends all its keys to distinct free slots
+template<std::size_t size>
+constexpr PerfectHashTable<size> BuildPerfectHash(const std::array<std::uint64_t, size> &hashes) {
+  using Table = PerfectHashTable<size>;
+
+  Table table;
+  std::array<std::size_t, Table::capacity> bucket_sizes{};
+  std::array<bool, Table::capacity> occupied{};
+  std::size_t largest = 0;
+
+  for (auto hash : hashes) {
+    auto &bucket_size = bucket_sizes[Table::Bucket(hash)];
+    largest = std::max(largest, ++bucket_size);
+  }
+
+  for (auto bucket_size = largest; bucket_size > 0; --bucket_size) {
+    for (std::size_t bucket = 0; bucket < Table::capacity; ++bucket) {
+      if (bucket_sizes[bucket] != bucket_size) {
+        continue;
+      }
+
+      std::array<std::size_t, size> members{};
+      std::size_t count = 0;
+
+      for (std::size_t i = 0; i < size; ++i) {
+        if (Table::Bucket(hashes[i]) == bucket) {
+          members[count++] = i;
+        }
+      }
+
+      for (std::uint64_t seed = 1;; ++seed) {
+        auto taken = occupied;
+        bool fits = true;
+
+        for (std::size_t k = 0; fits && k < count; ++k) {
+          auto slot = Table::Slot(hashes[members[k]], seed);
+          fits = !taken[slot];
+          taken[slot] = true;
+        }
+
+        if (fits) {
+          for (std::size_t k = 0; k < count; ++k) {
+            table.entries[Table::Slot(hashes[members[k]], seed)] = static_cast<std::uint32_t>(members[k]);
+          }
+
+          table.seeds[bucket] = seed;
+          occupied = taken;
+          break;
+        }
+      }
+    }
+  }
+
+  return table;
+}
+
+} // namespace
+
+// Static string-keyed map whose perfect hash is found during compilation. A lookup hashes the key
+// once, reads a bucket seed and a slot, and makes one compare with the only candidate key. The
+// tables are constexpr, so they end up in read-only data, and nothing is allocated.
+template<class Target, class... Mappings> requires
+(std::same_as<std::remove_cv_t<decltype(Mappings::Value)>, Target> && ...)
+struct PerfectHashMap {
+  static constexpr std::size_t size = sizeof...(Mappings);
+
+  static constexpr std::optional<Target> map(std::string_view key) {
+    if constexpr (size == 0) {
+      return std::nullopt;
+    } else {
+      auto hash = HashString(key, hash_seed);
+      auto index = table.entries[Table::Slot(hash, table.seeds[Table::Bucket(hash)])];
+
+      if (keys[index] == key) {
+        return values[index];
+      }
+
+      return std::nullopt;
+    }
+  }
+
+  static constexpr bool contains(std::string_view key) {
+    return map(key).has_value();
+  }
+
+ private:
+  using Table = PerfectHashTable<size>;
+
+  static constexpr std::array<std::string_view, size> keys{Mappings::Key...};
+  static constexpr std::array<Target, size> values{Mappings::Value...};
+
+  static_assert(AllDistinct(keys), "Keys have to be distinct");
+
+  static constexpr std::uint64_t hash_seed = FindHashSeed(keys);
+  static constexpr std::array<std::uint64_t, size> hashes = HashKeys(keys, hash_seed);
+
+  // Only equal keys leave equal hashes, and the build would never separate those
+  static constexpr Table table = AllDistinct(hashes) ? BuildPerfectHash(hashes) : Table{};
+};
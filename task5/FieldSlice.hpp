@@ -0,0 +1,170 @@
+#pragma once
+
+#include <Slice.hpp>
+#include <reflect.hpp>
+
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+// Like Slice, but consecutive elements are `byte_stride` bytes apart, which does not have to be a
+// multiple of sizeof(T). Used for fields whose record size is not a whole number of field sizes.
+template<class T, std::size_t extent = std::dynamic_extent>
+class ByteStrideSlice : public ExtentStorage<extent> {
+    using Byte = std::conditional_t<std::is_const_v<T>, const std::byte, std::byte>;
+
+ public:
+    ByteStrideSlice(T *first, std::size_t count, std::ptrdiff_t byte_stride)
+        : ExtentStorage<extent>(count), data_(reinterpret_cast<Byte *>(first)), byte_stride_(byte_stride) {}
+
+    class iterator {
+     public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<T>;
+        using pointer = T *;
+        using reference = T &;
+
+        friend ByteStrideSlice;
+
+        iterator() = default;
+
+        reference operator*() const {
+            return *reinterpret_cast<T *>(ptr_);
+        }
+
+        pointer operator->() const {
+            return reinterpret_cast<T *>(ptr_);
+        }
+
+        reference operator[](difference_type n) const {
+            return *(*this + n);
+        }
+
+        iterator &operator++() {
+            ptr_ += byte_stride_;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator copy(*this);
+            ++(*this);
+            return copy;
+        }
+
+        iterator &operator--() {
+            ptr_ -= byte_stride_;
+            return *this;
+        }
+
+        iterator operator--(int) {
+            iterator copy(*this);
+            --(*this);
+            return copy;
+        }
+
+        iterator &operator+=(difference_type n) {
+            ptr_ += n * byte_stride_;
+            return *this;
+        }
+
+        iterator operator+(difference_type n) const {
+            iterator copy(*this);
+            copy += n;
+            return copy;
+        }
+
+        friend iterator operator+(difference_type n, const iterator &other) {
+            return other + n;
+        }
+
+        iterator &operator-=(difference_type n) {
+            ptr_ -= n * byte_stride_;
+            return *this;
+        }
+
+        iterator operator-(difference_type n) const {
+            iterator copy(*this);
+            copy -= n;
+            return copy;
+        }
+
+        difference_type operator-(const iterator &other) const {
+            return (ptr_ - other.ptr_) / byte_stride_;
+        }
+
+        auto operator<=>(const iterator &other) const {
+            return (*this - other) <=> 0;
+        }
+
+        bool operator==(const iterator &other) const {
+            return ptr_ == other.ptr_;
+        }
+
+     private:
+        iterator(Byte *ptr, std::ptrdiff_t byte_stride) : ptr_(ptr), byte_stride_(byte_stride) {}
+
+        Byte *ptr_ = nullptr;
+        std::ptrdiff_t byte_stride_ = 1;
+    };
+
+    T &operator[](std::size_t index) const {
+        return *reinterpret_cast<T *>(data_ + static_cast<std::ptrdiff_t>(index) * byte_stride_);
+    }
+
+    iterator begin() const {
+        return {data_, byte_stride_};
+    }
+
+    iterator end() const {
+        return {data_ + static_cast<std::ptrdiff_t>(this->Size()) * byte_stride_, byte_stride_};
+    }
+
+    [[nodiscard]] std::ptrdiff_t ByteStride() const {
+        return byte_stride_;
+    }
+
+ private:
+    Byte *data_;
+    std::ptrdiff_t byte_stride_;
+};
+
+// Column view of field I (as numbered by Describe, annotations skipped) over contiguous records.
+// When the record size is a multiple of the field size the result is a plain Slice with a static
+// stride, so every Slice algorithm and kernel runs on the column unchanged; otherwise it is a
+// ByteStrideSlice. Nothing is copied, and the field is located through the structured binding
+// reflect.hpp already uses, so no offsetof is needed.
+template<std::size_t I, class Record, std::size_t extent>
+requires (I < Describe<std::remove_cv_t<Record>>::num_fields)
+auto FieldSlice(const Slice<Record, extent, 1> &records) {
+    using Plain = std::remove_cv_t<Record>;
+
+    constexpr std::size_t real_index = GetIndexOfRealField<Plain, I>();
+
+    // Describe decays its field types; the tuple of references keeps a const member const
+    using FieldType = std::remove_reference_t<
+        std::tuple_element_t<real_index, decltype(ConvertToTuple<Plain>(std::declval<Plain &>()))>>;
+    using Element = std::conditional_t<std::is_const_v<Record>, const FieldType, FieldType>;
+
+    static_assert(!std::is_array_v<FieldType>, "FieldSlice does not support array fields");
+
+    Element *first = nullptr;
+
+    if (records.Size() != 0) {
+        first = &std::get<real_index>(ConvertToTuple<Plain>(const_cast<Plain &>(records[0])));
+    }
+
+    if constexpr (sizeof(Plain) % sizeof(FieldType) == 0) {
+        constexpr auto stride = static_cast<std::ptrdiff_t>(sizeof(Plain) / sizeof(FieldType));
+        return Slice<Element, extent, stride>(first, records.Size(), stride);
+    } else {
+        return ByteStrideSlice<Element, extent>(first, records.Size(), sizeof(Plain));
+    }
+}
+
+template<std::size_t I, std::ranges::contiguous_range Container>
+requires std::ranges::sized_range<Container>
+auto FieldSlice(Container &records) {
+    using Record = std::remove_reference_t<std::ranges::range_reference_t<Container &>>;
+    return FieldSlice<I>(Slice<Record>(std::ranges::data(records), std::ranges::size(records), 1));
+}